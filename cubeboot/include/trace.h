@@ -0,0 +1,91 @@
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#include <gctypes.h>
+
+// Boot path timeline, shared between cubeboot and the IPL patches.
+//
+// cubeboot records into its own ring and copies it over the `trace_ring`
+// symbol of the patches image right after patching (like the settings).
+// The ring lives in the patches .data so it survives into the IPL, which
+// keeps appending and dumps everything in bs2start.
+
+#define TRACE_MAGIC 0x54524143 // 'TRAC'
+#define TRACE_RING_SIZE 512 // must be a power of two
+
+// chrome trace phases
+#define TRACE_PHASE_BEGIN   'B'
+#define TRACE_PHASE_END     'E'
+#define TRACE_PHASE_MARK    'i'
+#define TRACE_PHASE_COUNTER 'C'
+
+// dump targets
+#define TRACE_DUMP_NONE  0
+#define TRACE_DUMP_SD    1
+#define TRACE_DUMP_GECKO 2
+
+#define TRACE_DUMP_PATH "/cubeboot-trace.json"
+
+// keep in sync with TRACE_EVENT_NAMES
+typedef enum {
+    TRACE_CUBEBOOT = 0,  // cubeboot main until the jump into the IPL
+    TRACE_SETTINGS_LOAD,
+    TRACE_IPL_LOAD,
+    TRACE_PATCH_APPLY,
+    TRACE_IPL_START,     // first patched code running in the IPL
+    TRACE_MENU_INIT,
+    TRACE_MENU_READY,    // first game select frame
+    TRACE_ENUM,          // the whole enumeration thread
+    TRACE_ENUM_LIST,
+    TRACE_ENUM_SORT,
+    TRACE_ENUM_CHECK,
+    TRACE_ENUM_META,
+    TRACE_ENUM_LINES,
+    TRACE_SWISS_PRELOAD,
+    TRACE_GAME_BOOT,     // bs2start until the jump into the game
+    TRACE_DOL_LOAD,
+    TRACE_CRAWL_DIR,     // one directory visited by the background crawler
+    TRACE_POOL_ICONS,    // counter, icon buffers in use
+    TRACE_POOL_BANNERS,  // counter, banner buffers in use
+    TRACE_EVENT_COUNT,
+} trace_event_t;
+
+#define TRACE_EVENT_NAMES { \
+    "cubeboot", "settings_load", "ipl_load", "patch_apply", \
+    "ipl_start", "menu_init", "menu_ready", \
+    "enum", "enum_list", "enum_sort", "enum_check", "enum_meta", "enum_lines", \
+    "swiss_preload", "game_boot", "dol_load", "crawl_dir", \
+    "pool_icons", "pool_banners", \
+}
+
+typedef struct {
+    u64 time; // raw timebase
+    u16 event;
+    u8 phase;
+    u8 thread; // 0 is cubeboot, IPL threads are numbered as they show up
+    u32 arg;
+} trace_record_t;
+
+typedef struct {
+    u32 magic;
+    u32 head; // records written so far, the oldest are overwritten
+    u32 reserved[2];
+    trace_record_t records[TRACE_RING_SIZE];
+} trace_ring_t;
+
+extern trace_ring_t trace_ring;
+
+void trace_event(u16 event, u8 phase, u32 arg);
+
+#define trace_begin(event) trace_event(event, TRACE_PHASE_BEGIN, 0)
+#define trace_end(event, arg) trace_event(event, TRACE_PHASE_END, arg)
+#define trace_mark(event, arg) trace_event(event, TRACE_PHASE_MARK, arg)
+#define trace_counter(event, value) trace_event(event, TRACE_PHASE_COUNTER, value)
+
+// cubeboot only
+void trace_handoff(trace_ring_t *dst);
+
+// IPL only
+void trace_dump(u32 target);
+
+#endif
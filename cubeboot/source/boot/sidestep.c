@@ -17,7 +17,6 @@
 #include "ssaram.h"
 
 #define ARAMSTART 0
-#define ARAMSIZE (10 * 1024 * 1024)
 
 /*** A global or two ***/
 static DOLHEADER *dolhdr;
@@ -230,9 +229,6 @@ int DOLtoARAM(unsigned char *dol, int argc, char *argv[])
   int i;
   struct __argv dolargs;
 
-  // clear the part of ARAM we will use
-  ARAMClear(ARAMSTART, ARAMSIZE);
-
   /*** Get DOL header ***/
   dolhdr = (DOLHEADER *) dol;
 
@@ -244,6 +240,9 @@ int DOLtoARAM(unsigned char *dol, int argc, char *argv[])
   DOLMinMax(dolhdr);
   sizeinbytes = maxaddress - minaddress;
 
+  /*** Only the span ARAMRun copies back needs clearing ***/
+  ARAMClear(ARAMSTART, sizeinbytes);
+
   /*** Move all DOL sections into ARAM ***/
   /*** Move text sections ***/
   for (i = 0; i < MAXTEXTSECTION; i++)
@@ -12,6 +12,11 @@
 
 static u8 aramfix[2048] ATTRIBUTE_ALIGN(32);
 
+/*** Source for clears, never written so it stays zero ***/
+#define ARAM_ZERO_SIZE (32 * 1024)
+static u8 aramzero[ARAM_ZERO_SIZE] ATTRIBUTE_ALIGN(32);
+static bool aramzero_flushed = false;
+
 #define ARAM_READ  1
 #define ARAM_WRITE 0
 
@@ -89,22 +94,29 @@ static void __ARWriteDMA(u32 memaddr,u32 aramaddr,u32 len)
 /****************************************************************************
 * ARAMClear
 *
-* To make life easy, just clear out the Auxilliary RAM completely.
+* Zero [start, start + length) of the Auxilliary RAM in 32k bursts from a
+* zero buffer. The range is widened to 32 byte boundaries.
 ****************************************************************************/
 void ARAMClear(u32 start, u32 length)
 {
-  int i;
-  unsigned char *buffer = memalign(32, 2048); /*** A little 2k buffer ***/
-
-  memset(buffer, 0, 2048);
-  DCFlushRange(buffer, 2048);
+  if (length == 0)
+    return;
 
-  for (i = start; i < 0x1000000 - length; i += 2048)
+  if (!aramzero_flushed)
   {
-    ARAMPut(buffer, (char *) i, 2048);
+    DCFlushRange(aramzero, ARAM_ZERO_SIZE);
+    aramzero_flushed = true;
   }
 
-  free(buffer);
+  u32 end = (start + length + 0x1f) & ~0x1f;
+  for (u32 i = start & ~0x1f; i < end; i += ARAM_ZERO_SIZE)
+  {
+    u32 len = end - i;
+    if (len > ARAM_ZERO_SIZE)
+      len = ARAM_ZERO_SIZE;
+
+    __ARWriteDMA((u32) aramzero, i, len);
+  }
 }
 
 /****************************************************************************
@@ -2,6 +2,7 @@
 
 #include <string.h>
 #include "ffs/ff.h"
+#include "ffs/diskio.h"
 #include "tweaks.h"
 
 #ifdef IPL_CODE
@@ -74,6 +75,23 @@ bool flippy_emu_mount() {
 
 static FIL file;
 static FFDIR dir;
+static uint8_t file_flags;
+
+// fast seek table, two entries per fragment plus the header
+static DWORD file_clmt[128];
+
+// read-ahead window for small reads, large transfers go straight to the card
+#define READ_CACHE_SIZE 0x4000
+#define READ_CACHE_ALIGN FF_MIN_SS
+static uint8_t read_cache[READ_CACHE_SIZE] __attribute__((aligned(32)));
+static FSIZE_t read_cache_offset;
+static UINT read_cache_len;
+
+static void emu_dev_path(char *dst, const char *path) {
+	memcpy(dst, emu_get_device(), strlen(emu_get_device()) + 1);
+	strcat(dst, ":");
+	strcat(dst, path);
+}
 
 int dvd_custom_open(const char* path, uint8_t type, uint8_t flags) {
 	if (!flippy_emu_mount())
@@ -82,9 +100,7 @@ int dvd_custom_open(const char* path, uint8_t type, uint8_t flags) {
 	dvd_custom_close(1);
 
 	char dev_path[256];
-	memcpy(dev_path, emu_get_device(), strlen(emu_get_device()) + 1);
-	strcat(dev_path, ":");
-	strcat(dev_path, path);
+	emu_dev_path(dev_path, path);
 
 	if (type == FILE_ENTRY_TYPE_DIR) {
 		return f_opendir(&dir, dev_path) == FR_OK ? 0 : 1;
@@ -95,7 +111,25 @@ int dvd_custom_open(const char* path, uint8_t type, uint8_t flags) {
 		if (flags & IPC_FILE_FLAG_WRITE)
 			ffs_flags |= FA_WRITE | FA_OPEN_ALWAYS;
 
-		return f_open(&file, dev_path, ffs_flags) == FR_OK ? 0 : 1;
+		if (f_open(&file, dev_path, ffs_flags) != FR_OK)
+			return 1;
+
+		// writable files must stay coherent, never serve them from the window
+		file_flags = flags;
+		if (flags & IPC_FILE_FLAG_WRITE)
+			file_flags |= IPC_FILE_FLAG_DISABLECACHE;
+
+		// the link map costs a walk of the whole FAT chain, skip it for one-shot reads
+		// and for writable files (fast seek mode cannot grow a file)
+		if ((file_flags & (IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_WRITE)) == 0) {
+			file_clmt[0] = sizeof(file_clmt) / sizeof(file_clmt[0]);
+			file.cltbl = file_clmt;
+			if (f_lseek(&file, CREATE_LINKMAP) != FR_OK)
+				file.cltbl = NULL; // too fragmented, fall back to following the chain
+		}
+
+		// IPC_FILE_FLAG_DISABLESPEEDEMU needs no handling, the SD path has no speed emulation
+		return 0;
 	}
 
 	return 1;
@@ -143,12 +177,43 @@ int dvd_custom_status(file_status_t* status) {
 	#endif
 }
 
+static int dvd_read_cached(void* dst, unsigned int len, uint64_t offset) {
+	FSIZE_t cache_end = read_cache_offset + read_cache_len;
+	if (offset < read_cache_offset || offset + len > cache_end) {
+		FSIZE_t base = offset & ~(FSIZE_t)(READ_CACHE_ALIGN - 1);
+		read_cache_len = 0;
+
+		if (f_lseek(&file, base) != FR_OK)
+			return 1;
+
+		UINT bytes_read;
+		if (f_read(&file, read_cache, READ_CACHE_SIZE, &bytes_read) != FR_OK)
+			return 1;
+
+		read_cache_offset = base;
+		read_cache_len = bytes_read;
+		cache_end = base + bytes_read;
+	}
+
+	// short reads at the end of the file behave like f_read
+	if (offset >= cache_end)
+		return 0;
+	if (offset + len > cache_end)
+		len = cache_end - offset;
+
+	memcpy(dst, &read_cache[offset - read_cache_offset], len);
+	return 0;
+}
+
 int dvd_read(void* dst, unsigned int len, uint64_t offset, unsigned int fd) {
 	if (passthrough) {
 		extern int normal_dvd_read(void* dst, unsigned int len, uint64_t offset, unsigned int fd);
 		return normal_dvd_read(dst, len, offset, fd);
 	}
 
+	if ((file_flags & IPC_FILE_FLAG_DISABLECACHE) == 0 && len < READ_CACHE_SIZE)
+		return dvd_read_cached(dst, len, offset);
+
 	FRESULT res;
 	UINT bytes_read;
 	
@@ -169,38 +234,81 @@ int dvd_threaded_read(void* dst, unsigned int len, uint64_t offset, unsigned int
 	return dvd_read(dst, len, offset, fd);
 }
 
-int dvd_custom_readdir(file_entry_t* dst, unsigned int fd) {
-	FILINFO fno;
+static int readdir_next(file_entry_t* dst, FILINFO* fno) {
 	FRESULT res;
 
-	fno.fname[0] = 0;
-	res = f_readdir(&dir, &fno);
+	fno->fname[0] = 0;
+	res = f_readdir(&dir, fno);
 	if (res != FR_OK)
 		return 1;
 	
-	if (fno.fname[0] == 0) {
+	if (fno->fname[0] == 0) {
 		dst->name[0] = 0;
 		return 0;
 	}
 
-	strcpy(dst->name, fno.fname);
-	dst->type = (fno.fattrib & AM_DIR) ? FILE_ENTRY_TYPE_DIR : FILE_ENTRY_TYPE_FILE;
-	dst->size = fno.fsize;
-	dst->attrib = fno.fattrib;
+	strcpy(dst->name, fno->fname);
+	dst->type = (fno->fattrib & AM_DIR) ? FILE_ENTRY_TYPE_DIR : FILE_ENTRY_TYPE_FILE;
+	dst->size = fno->fsize;
+	dst->date = fno->fdate;
+	dst->time = fno->ftime;
+	dst->attrib = fno->fattrib;
 	
 	return 0;
 }
 
+int dvd_custom_readdir(file_entry_t* dst, unsigned int fd) {
+	FILINFO fno;
+	return readdir_next(dst, &fno);
+}
+
+// whole sectors for the header prefetch
+static uint8_t readdir_header_buf[0x800] __attribute__((aligned(32)));
+
+// Like dvd_custom_readdir, but also returns the first header_len bytes of regular files.
+// The data is read straight from the first cluster of the entry, so listing a directory
+// stays a single sequential pass without a path lookup and open per file.
+// header_read is left at zero when nothing could be prefetched.
+int dvd_custom_readdir_header(file_entry_t* dst, void* header, uint32_t header_len, uint32_t* header_read, unsigned int fd) {
+	FILINFO fno;
+	*header_read = 0;
+
+	int ret = readdir_next(dst, &fno);
+	if (ret != 0 || dst->name[0] == 0 || dst->type != FILE_ENTRY_TYPE_FILE)
+		return ret;
+
+	if (fno.fsize < header_len || fno.fclust < 2 || fno.fclust >= fs.n_fatent)
+		return 0;
+
+	// the header has to fit in the first cluster
+	UINT sector_count = (header_len + FF_MIN_SS - 1) / FF_MIN_SS;
+	if (sector_count * FF_MIN_SS > sizeof(readdir_header_buf) || sector_count > fs.csize)
+		return 0;
+
+	LBA_t sector = fs.database + (LBA_t)fs.csize * (fno.fclust - 2);
+	if (disk_read(fs.pdrv, readdir_header_buf, sector, sector_count) != RES_OK)
+		return 0;
+
+	memcpy(header, readdir_header_buf, header_len);
+	*header_read = header_len;
+	return 0;
+}
+
 int dvd_custom_mkdir(char* path) {
 	if (!flippy_emu_mount())
 		return 1;
 
-	return f_mkdir(path) == FR_OK ? 0 : 1;
+	char dev_path[256];
+	emu_dev_path(dev_path, path);
+	return f_mkdir(dev_path) == FR_OK ? 0 : 1;
 }
 
 void dvd_custom_close(uint32_t fd) {
 	f_close(&file);
 	f_closedir(&dir);
+
+	file_flags = 0;
+	read_cache_len = 0;
 }
 
 void dvd_custom_bypass_enter() {
@@ -226,17 +334,32 @@ void dvd_custom_bypass_exit() {
 }
 
 
-// not implemented
 int dvd_custom_write(char *buf, uint32_t offset, uint32_t length, uint32_t fd) {
-	return 1;
+	if (!(file_flags & IPC_FILE_FLAG_WRITE))
+		return 1;
+
+	if (f_lseek(&file, offset) != FR_OK)
+		return 1;
+
+	UINT written = 0;
+	if (f_write(&file, buf, length, &written) != FR_OK || written != length)
+		return 1;
+
+	return 0;
 }
 
+// not implemented
 void dvd_set_default_fd(uint32_t current_fd, uint32_t second_fd) {
 
 }
 
 int dvd_custom_unlink(char *path) {
-	return 1;
+	if (!flippy_emu_mount())
+		return 1;
+
+	char dev_path[256];
+	emu_dev_path(dev_path, path);
+	return f_unlink(dev_path) == FR_OK ? 0 : 1;
 }
 
 int dvd_custom_unlink_flash(char *path) {
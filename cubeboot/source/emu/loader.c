@@ -5,7 +5,245 @@
 #include "../os.h"
 #include "../flippy_sync.h"
 #include "../usbgecko.h"
+#include "../reloc.h"
+#include "../attr.h"
+#include "../dol.h"
+#include "../crc32.h"
+#include "../time.h"
+#include "../decomp_ar.h"
+#include "../dolphin_arq.h"
 #include "tweaks.h"
+#include "../aram.h"
+
+#define SWISS_CHUNK_SIZE 0x8000
+
+typedef struct {
+    u32 address;
+    u32 file_offset;
+    u32 length;
+    u32 aram_offset;
+    u32 crc;
+} swiss_section_t;
+
+typedef struct {
+    bool valid; // header checked, sections fit in ARAM
+    bool ready; // every section is in ARAM
+    u32 aram_base; // one block for all sections
+    int section_count;
+    swiss_section_t sections[MAXTEXTSECTION + MAXDATASECTION];
+
+    // resume point for the background copy
+    int next_section;
+    u32 next_offset;
+} swiss_aram_t;
+
+__attribute__((aligned(32))) static DOLHEADER swiss_hdr;
+static swiss_aram_t swiss_aram;
+__attribute_aligned_data_lowmem__ static u8 swiss_chunk_buf[SWISS_CHUNK_SIZE];
+
+static void swiss_add_section(u32 address, u32 file_offset, u32 length) {
+    swiss_section_t *sec = &swiss_aram.sections[swiss_aram.section_count++];
+    sec->address = address;
+    sec->file_offset = file_offset;
+    sec->length = length;
+    sec->crc = 0;
+
+    // keep file order so the copy is a sequential read
+    while (sec > &swiss_aram.sections[0] && sec[-1].file_offset > sec->file_offset) {
+        swiss_section_t tmp = sec[-1];
+        sec[-1] = *sec;
+        *sec = tmp;
+        sec--;
+    }
+}
+
+static bool swiss_check_header(u32 file_size) {
+    DOLHEADER *hdr = &swiss_hdr;
+    swiss_aram.section_count = 0;
+
+    if (hdr->entryPoint < 0x80000000 || hdr->entryPoint >= 0x81800000)
+        return false;
+
+    for (int i = 0; i < MAXTEXTSECTION + MAXDATASECTION; i++) {
+        u32 address = i < MAXTEXTSECTION ? hdr->textAddress[i] : hdr->dataAddress[i - MAXTEXTSECTION];
+        u32 offset = i < MAXTEXTSECTION ? hdr->textOffset[i] : hdr->dataOffset[i - MAXTEXTSECTION];
+        u32 length = i < MAXTEXTSECTION ? hdr->textLength[i] : hdr->dataLength[i - MAXTEXTSECTION];
+        if (address == 0 || length == 0)
+            continue;
+
+        if (offset + length > file_size || offset + length < offset)
+            return false;
+        if (address < 0x80000000 || address + length > 0x81800000)
+            return false;
+        if (address & 31) // the ARAM DMA needs aligned destinations
+            return false;
+
+        swiss_add_section(address, offset, length);
+    }
+
+    u32 aram_len = 0;
+    for (int i = 0; i < swiss_aram.section_count; i++) {
+        aram_len += (swiss_aram.sections[i].length + 31) & ~31;
+    }
+
+    swiss_aram.aram_base = aram_alloc(ARAM_OWNER_SWISS, aram_len);
+    if (swiss_aram.aram_base == ARAM_NONE)
+        return false;
+
+    u32 aram_offset = swiss_aram.aram_base;
+    for (int i = 0; i < swiss_aram.section_count; i++) {
+        swiss_aram.sections[i].aram_offset = aram_offset;
+        aram_offset += (swiss_aram.sections[i].length + 31) & ~31;
+    }
+
+    return true;
+}
+
+bool swiss_probe() {
+    aram_free(swiss_aram.aram_base);
+    memset(&swiss_aram, 0, sizeof(swiss_aram_t));
+
+    dvd_custom_open_flash("/swiss-gc.dol", FILE_ENTRY_TYPE_FILE, IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK);
+    file_status_t* status = dvd_custom_status();
+    if (status == NULL || status->result != 0) {
+        dvd_custom_close(status ? status->fd : 0);
+        return false;
+    }
+
+    u32 file_size = (u32)__builtin_bswap64(*(u64*)(&status->fsize));
+    if (file_size > sizeof(DOLHEADER)) {
+        dvd_read(&swiss_hdr, sizeof(DOLHEADER), 0, status->fd);
+        swiss_aram.valid = swiss_check_header(file_size);
+    }
+    dvd_custom_close(status->fd);
+
+    if (!swiss_aram.valid)
+        OSReport("WARNING: swiss-gc.dol will be loaded from SD\n");
+
+    return true;
+}
+
+static volatile bool swiss_store_bsy = false;
+static void swiss_store_cb(u32 arq_request_ptr) {
+    swiss_store_bsy = false;
+}
+
+static void swiss_store(void *src, u32 aram_offset, u32 length) {
+    static ARQRequest req;
+    u32 owner = ARAM_OWNER_SWISS;
+    u32 type = ARAM_DIR_MRAM_TO_ARAM;
+    u32 priority = ARQ_PRIORITY_LOW;
+
+    swiss_store_bsy = true;
+    DCFlushRange(src, length);
+    dolphin_ARQPostRequest(&req, owner, type, priority, (u32)src, aram_offset, length, &swiss_store_cb);
+    while (swiss_store_bsy)
+        OSYieldThread();
+}
+
+// Copies the swiss sections into ARAM from the enumeration thread, stops early when the
+// enumeration is cancelled and picks up at the same chunk on the next call
+void swiss_preload_aram() {
+    if (!swiss_aram.valid || swiss_aram.ready)
+        return;
+
+    u64 start_time = gettime();
+    dvd_custom_open_flash("/swiss-gc.dol", FILE_ENTRY_TYPE_FILE, IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLESPEEDEMU);
+    file_status_t* status = dvd_custom_status();
+    if (status == NULL || status->result != 0) {
+        dvd_custom_close(status ? status->fd : 0);
+        swiss_aram.valid = false;
+        return;
+    }
+
+    while (swiss_aram.next_section < swiss_aram.section_count) {
+        swiss_section_t *sec = &swiss_aram.sections[swiss_aram.next_section];
+        while (swiss_aram.next_offset < sec->length) {
+            if (gm_enum_cancelled()) {
+                OSReport("Swiss preload paused\n");
+                dvd_custom_close(status->fd);
+                return;
+            }
+
+            u32 len = sec->length - swiss_aram.next_offset;
+            if (len > SWISS_CHUNK_SIZE)
+                len = SWISS_CHUNK_SIZE;
+            u32 dma_len = (len + 31) & ~31;
+
+            if (dvd_read(swiss_chunk_buf, len, sec->file_offset + swiss_aram.next_offset, status->fd) != 0) {
+                dvd_custom_close(status->fd);
+                swiss_aram.valid = false;
+                return;
+            }
+            memset(&swiss_chunk_buf[len], 0, dma_len - len);
+
+            sec->crc = tinf_crc32_update(sec->crc, swiss_chunk_buf, len);
+            swiss_store(swiss_chunk_buf, sec->aram_offset + swiss_aram.next_offset, dma_len);
+            swiss_aram.next_offset += len;
+        }
+
+        swiss_aram.next_section++;
+        swiss_aram.next_offset = 0;
+    }
+
+    dvd_custom_close(status->fd);
+    swiss_aram.ready = true;
+
+    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
+    OSReport("Swiss preload took=%f\n", runtime);
+    (void)runtime;
+}
+
+// Runs with interrupts disabled, so only polled DMA is used here
+static bool swiss_load_aram(dol_info_t *info) {
+    if (!swiss_aram.ready)
+        return false;
+
+    u64 start_time = gettime();
+    DOLHEADER *hdr = &swiss_hdr;
+    if (hdr->bssAddress && hdr->bssLength) {
+        memset((void*)hdr->bssAddress, 0, hdr->bssLength);
+        DCFlushRange((void*)hdr->bssAddress, hdr->bssLength);
+    }
+
+    __attribute__((aligned(32))) static u8 tail_buf[32];
+    for (int i = 0; i < swiss_aram.section_count; i++) {
+        swiss_section_t *sec = &swiss_aram.sections[i];
+        u32 body_len = sec->length & ~31;
+        u32 tail_len = sec->length & 31;
+
+        if (body_len) {
+            DCFlushRange((void*)sec->address, body_len);
+            __ARReadDMA(sec->address, sec->aram_offset, body_len);
+            DCInvalidateRange((void*)sec->address, body_len);
+        }
+
+        // the tail is bounced so the DMA never writes past the section
+        if (tail_len) {
+            DCInvalidateRange(tail_buf, sizeof(tail_buf));
+            __ARReadDMA((u32)tail_buf, sec->aram_offset + body_len, sizeof(tail_buf));
+            DCInvalidateRange(tail_buf, sizeof(tail_buf));
+            memcpy((void*)(sec->address + body_len), tail_buf, tail_len);
+        }
+
+        if (tinf_crc32_update(0, (void*)sec->address, sec->length) != sec->crc) {
+            custom_OSReport("Swiss ARAM copy is corrupt (section %08x)\n", sec->address);
+            return false;
+        }
+
+        DCFlushRange((void*)sec->address, sec->length);
+        ICInvalidateRange((void*)sec->address, sec->length);
+    }
+
+    info->entrypoint = (void*)hdr->entryPoint;
+    info->max_addr = DOLMax(hdr);
+
+    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
+    custom_OSReport("Swiss ARAM load took=%f\n", runtime);
+    (void)runtime;
+
+    return true;
+}
 
 static int setup_argv(const char** string_list, char* buffer, struct __argv* argv_struct, u32 magic) {
     int buffer_len = 0;
@@ -70,7 +308,8 @@ void chainload_swiss_game(char* game_path, bool passthrough) {
         run(info.entrypoint);
     }
 
-    info = load_dol_file("/swiss-gc.dol", true);
+    if (!swiss_load_aram(&info))
+        info = load_dol_file("/swiss-gc.dol", true);
     
     char autoload_arg[256];
     if (passthrough) {
@@ -84,7 +323,7 @@ void chainload_swiss_game(char* game_path, bool passthrough) {
     }
 
     char* igr_type = NULL;
-    dvd_custom_open_flash("/swiss/patches/apploader.img", FILE_ENTRY_TYPE_FILE, 0);
+    dvd_custom_open_flash("/swiss/patches/apploader.img", FILE_ENTRY_TYPE_FILE, IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK);
     file_status_t* status = dvd_custom_status();
     if (status != NULL && status->result == 0) {
         igr_type = "IGRType=Apploader";
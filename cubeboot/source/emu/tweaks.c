@@ -12,11 +12,16 @@
 #include "../crc32.h"
 #include "../sd.h"
 #else
+#include "../reloc.h"
 #include "../gc_dvd.h"
+#include "../dvd_threaded.h"
+#include "../crc32.h"
 #include "../time.h"
 #include "../attr.h"
 #include "../dolphin_arq.h"
 #include "../usbgecko.h"
+#include "../game_index.h"
+#include "../aram.h"
 #endif
 
 
@@ -24,10 +29,7 @@
 static bool found_swiss = false;
 
 void emu_update_boot() {
-    dvd_custom_open_flash("/swiss-gc.dol", FILE_ENTRY_TYPE_FILE, 0);
-    file_status_t* status = dvd_custom_status();
-    found_swiss = (status != NULL && status->result == 0);
-    dvd_custom_close(status->fd);
+    found_swiss = swiss_probe();
 }
 
 bool emu_can_boot(gm_file_type_t type) {
@@ -67,87 +69,848 @@ bool emu_has_dvd() {
 }
 
 
-static volatile bool bnr_store_bsy = false;
-static void bnr_cache_store_cb(u32 arq_request_ptr) {
-    bnr_store_bsy = false;
+typedef struct {
+    ARQRequest req; // first, the callback gets its address
+    volatile bool busy;
+} bnr_cache_dma_t;
+
+static void bnr_cache_dma_cb(u32 arq_request_ptr) {
+    ((bnr_cache_dma_t*)arq_request_ptr)->busy = false;
 }
 
-void bnr_cache_store(BNR* bnr, u32 aram_offset) {
-    custom_OSReport("Store banner at: 0x%x\n", aram_offset);
-    static ARQRequest req;
-    u32 owner = make_type('I', 'X', 'X', 'S');
-    u32 type = ARAM_DIR_MRAM_TO_ARAM;
-    u32 priority = ARQ_PRIORITY_LOW;
-    u32 source = (u32)bnr;
-    u32 dest = aram_offset;
-    u32 length = sizeof(BNR);
-
-    bnr_store_bsy = true;
-    DCFlushRange(bnr, sizeof(BNR));
-    dolphin_ARQPostRequest(&req, owner, type, priority, source, dest, length, &bnr_cache_store_cb);
-    while (bnr_store_bsy)
+// one request per side, the asset loader reads while the enum thread writes
+static bnr_cache_dma_t bnr_dma_store;
+static bnr_cache_dma_t bnr_dma_load;
+
+static void bnr_cache_dma(bnr_cache_dma_t *dma, u32 type, void* mram, u32 aram_offset, u32 length) {
+    u32 owner = type == ARAM_DIR_MRAM_TO_ARAM ? ARAM_OWNER_BANNER : make_type('I', 'X', 'X', 'L');
+    u32 source = type == ARAM_DIR_MRAM_TO_ARAM ? (u32)mram : aram_offset;
+    u32 dest = type == ARAM_DIR_MRAM_TO_ARAM ? aram_offset : (u32)mram;
+
+    dma->busy = true;
+    if (type == ARAM_DIR_MRAM_TO_ARAM) {
+        DCFlushRange(mram, length);
+    } else {
+        DCInvalidateRange(mram, length);
+    }
+    dolphin_ARQPostRequest(&dma->req, owner, type, ARQ_PRIORITY_LOW, source, dest, length, &bnr_cache_dma_cb);
+    while (dma->busy)
         OSYieldThread();
 }
 
-static volatile bool bnr_load_bsy = false;
-static void bnr_cache_load_cb(u32 arq_request_ptr) {
-    bnr_load_bsy = false;
+void bnr_cache_store(BNR* bnr, u32 aram_offset, u32 length) {
+    custom_OSReport("Store banner at: 0x%x\n", aram_offset);
+    bnr_cache_dma(&bnr_dma_store, ARAM_DIR_MRAM_TO_ARAM, bnr, aram_offset, length);
 }
 
-void bnr_cache_load(BNR* bnr, u32 aram_offset) {
+static void bnr_cache_load_range(void* dst, u32 aram_offset, u32 length) {
     custom_OSReport("Load banner from: 0x%x\n", aram_offset);
-    static ARQRequest req;
-    u32 owner = make_type('I', 'X', 'X', 'L');
-    u32 type = ARAM_DIR_ARAM_TO_MRAM;
-    u32 priority = ARQ_PRIORITY_LOW;
-    u32 source = aram_offset;
-    u32 dest = (u32)bnr;
-    u32 length = sizeof(BNR);
-
-    bnr_load_bsy = true;
-    dolphin_ARQPostRequest(&req, owner, type, priority, source, dest, length, &bnr_cache_load_cb);
-    while (bnr_load_bsy)
-        OSYieldThread();
-    DCFlushRange(bnr, sizeof(BNR));
+    bnr_cache_dma(&bnr_dma_load, ARAM_DIR_ARAM_TO_MRAM, dst, aram_offset, length);
 }
 
-#define BNR_CACHE_SIZE 1024
+// Banner cache
+// Whole BNRs in ARAM, one allocator block each, looked up by (game id, disc).
+// Compact banners stop after the first description (the one the menu shows)
+// and are packed back to back into larger pages, about a quarter more fit.
+// Capacity follows the free ARAM at first use, eviction is CLOCK and skips
+// banners that are pinned because they are on screen.
+//
+// The slot table is mirrored into ARAM_PERSIST_BASE, which survives a soft
+// reset, so a warm return to the menu takes the blocks back instead of
+// reading the banners again. A game may have used that ARAM in between, so
+// restored banners are checksummed on their first load. With the setting
+// on, the cache is also kept on SD for cold boots.
+#define BNR_CACHE_MAX 1536 // sizes the index, the real capacity is usually lower
+
+#define BNR_CACHE_MAGIC make_type('C', 'B', 'N', 'R')
+#define BNR_CACHE_VERSION 2
+#define BNR_CACHE_DIR "/cubiboot"
+#define BNR_CACHE_SNAPSHOT_PATH "/cubiboot/banners.bin"
+#define BNR_CACHE_SNAPSHOT_ALT_PATH "/cubiboot/banners.alt"
+
+#define BNR_COMPACT_SIZE offsetof(BNR, desc[1])
+#define BNR_CACHE_PAGE_SIZE (64 * 1024)
+#define BNR_CACHE_PAGE_SLOTS (BNR_CACHE_PAGE_SIZE / BNR_COMPACT_SIZE)
+#define BNR_CACHE_MAX_PAGES (BNR_CACHE_MAX / BNR_CACHE_PAGE_SLOTS + 1)
+
+#define BNR_CACHE_CHECK_PIXELS 0x1 // restored, pixel data not checked yet
+#define BNR_CACHE_CHECK_FULL   0x2 // restored, whole banner not checked yet
+
+typedef struct {
+    u32 magic;
+    u16 version;
+    u16 record_size;
+    u32 bnr_size;
+    u32 count; // records that follow
+    u32 saved; // the snapshot on SD matches
+    u32 generation; // the newer of the two snapshot files wins
+    u32 crc; // of the fields above
+    u32 reserved[1];
+} bnr_cache_header_t;
 
 typedef struct {
     u8 game_id[6];
-    u32 aram_offset;
+    u8 disc_num;
+    u8 valid;
+    u32 aram_offset; // in the snapshot, the index of the banner after the records
+    u32 bnr_crc;
+    u32 pixel_crc;
+    u32 crc; // of the fields above
+    u32 reserved[2];
+} bnr_cache_record_t;
+
+// the table is streamed in units of 32 bytes, the header then one record per slot
+_Static_assert(sizeof(bnr_cache_header_t) == 32);
+_Static_assert(sizeof(bnr_cache_record_t) == 32);
+_Static_assert(sizeof(bnr_cache_header_t) + BNR_CACHE_MAX * sizeof(bnr_cache_record_t) <= ARAM_PERSIST_SIZE);
+_Static_assert(BNR_COMPACT_SIZE % 32 == 0); // ARAM DMA granularity
+
+typedef struct {
+    u8 game_id[6];
+    u8 disc_num;
     bool valid;
+    u32 aram_offset; // kept when the slot is reused
+    u32 bnr_crc;
+    u32 pixel_crc;
+    u8 referenced; // second chance bit
+    u8 pins;
+    u8 check;
 } bnr_cache_entry_t;
 
-static bnr_cache_entry_t bnr_cache[BNR_CACHE_SIZE] = {0};
-static u32 bnr_cache_next_index = 0;
+__attribute_data__ u32 bnr_snapshot_enabled = 0;
+__attribute_data__ u32 bnr_compact_enabled = 0;
 
-bool bnr_cache_get(u8 game_id[6], BNR* bnr) {
-    for (int i = 0; i < BNR_CACHE_SIZE; i++) {
-        if (bnr_cache[i].valid && memcmp(bnr_cache[i].game_id, game_id, 6) == 0) {
-            bnr_cache_load(bnr, bnr_cache[i].aram_offset);
-            return true;
+static bnr_cache_entry_t bnr_cache[BNR_CACHE_MAX] = {0};
+static u32 bnr_cache_count = 0; // slots that own an ARAM block
+static u32 bnr_cache_capacity = 0;
+static u32 bnr_cache_hand = 0;
+static bool bnr_cache_dirty = false; // differs from the snapshot on SD
+static u32 bnr_cache_epoch = 0; // bumped whenever a slot changes, a save that sees it move gives up
+
+// compact slots are carved from one page at a time
+static u32 bnr_cache_page = ARAM_NONE;
+static u32 bnr_cache_page_used = 0;
+static u32 bnr_cache_pages[BNR_CACHE_MAX_PAGES]; // taken back by the ARAM restore
+static u32 bnr_cache_page_count = 0;
+
+static u32 bnr_cache_hits = 0;
+static u32 bnr_cache_misses = 0;
+static u32 bnr_cache_evictions = 0;
+
+// (game id, disc) -> slot, lowmem is not zeroed so it is set up on first use
+__attribute_data_lowmem__ static game_index_slot_t bnr_cache_index_slots[BNR_CACHE_MAX * 2];
+static game_index_t bnr_cache_index;
+static bool bnr_cache_index_ready = false;
+
+// staging for the table and the snapshot, only used with the card mutex held
+__attribute_aligned_data_lowmem__ static u8 bnr_cache_scratch[ARAM_BLOCK_SIZE];
+
+static inline u32 bnr_cache_aram_offset(u32 slot) {
+    return bnr_cache[slot].aram_offset;
+}
+
+// bytes one banner takes in ARAM and in the snapshot
+static inline u32 bnr_cache_unit_size() {
+    return bnr_compact_enabled ? BNR_COMPACT_SIZE : sizeof(BNR);
+}
+
+// ARAM for one more banner, ARAM_NONE when full
+static u32 bnr_cache_unit_alloc() {
+    if (!bnr_compact_enabled)
+        return aram_alloc(ARAM_OWNER_BANNER, sizeof(BNR));
+
+    if (bnr_cache_page == ARAM_NONE || bnr_cache_page_used == BNR_CACHE_PAGE_SLOTS) {
+        u32 page = aram_alloc(ARAM_OWNER_BANNER, BNR_CACHE_PAGE_SIZE);
+        if (page == ARAM_NONE) return ARAM_NONE;
+
+        bnr_cache_page = page;
+        bnr_cache_page_used = 0;
+    }
+
+    return bnr_cache_page + bnr_cache_page_used++ * BNR_COMPACT_SIZE;
+}
+
+// undoes the last alloc or reserve, a compact slot in a restored page stays unused
+static void bnr_cache_unit_free(u32 aram_offset) {
+    if (!bnr_compact_enabled) {
+        aram_free(aram_offset);
+    } else if (bnr_cache_page_used > 0 && aram_offset == bnr_cache_page + (bnr_cache_page_used - 1) * BNR_COMPACT_SIZE) {
+        bnr_cache_page_used--;
+    }
+}
+
+// banners the free ARAM still holds
+static u32 bnr_cache_unit_room() {
+    if (!bnr_compact_enabled)
+        return aram_free_size() / aram_alloc_size(sizeof(BNR));
+
+    u32 left = bnr_cache_page == ARAM_NONE ? 0 : BNR_CACHE_PAGE_SLOTS - bnr_cache_page_used;
+    return left + aram_free_size() / BNR_CACHE_PAGE_SIZE * BNR_CACHE_PAGE_SLOTS;
+}
+
+// takes back the ARAM of a restored record, compact ones share their page
+static bool bnr_cache_unit_reserve(u32 aram_offset) {
+    if (!bnr_compact_enabled)
+        return aram_offset % ARAM_BLOCK_SIZE == 0 && aram_reserve(ARAM_OWNER_BANNER, aram_offset, sizeof(BNR));
+
+    u32 page = aram_offset & ~(BNR_CACHE_PAGE_SIZE - 1);
+    u32 index = (aram_offset - page) / BNR_COMPACT_SIZE;
+    if ((aram_offset - page) % BNR_COMPACT_SIZE != 0 || index >= BNR_CACHE_PAGE_SLOTS)
+        return false;
+
+    for (u32 i = 0; i < bnr_cache_page_count; i++) {
+        if (bnr_cache_pages[i] == page) return true;
+    }
+
+    if (bnr_cache_page_count == BNR_CACHE_MAX_PAGES || !aram_reserve(ARAM_OWNER_BANNER, page, BNR_CACHE_PAGE_SIZE))
+        return false;
+
+    bnr_cache_pages[bnr_cache_page_count++] = page;
+    return true;
+}
+
+static void bnr_cache_make_header(bnr_cache_header_t *header, u32 count, bool saved, u32 generation) {
+    memset(header, 0, sizeof(bnr_cache_header_t));
+    header->magic = BNR_CACHE_MAGIC;
+    header->version = BNR_CACHE_VERSION;
+    header->record_size = sizeof(bnr_cache_record_t);
+    header->bnr_size = bnr_cache_unit_size();
+    header->count = count;
+    header->saved = saved;
+    header->generation = generation;
+    header->crc = tinf_crc32(header, offsetof(bnr_cache_header_t, crc));
+}
+
+static bool bnr_cache_header_valid(bnr_cache_header_t *header, u32 max_count) {
+    if (header->magic != BNR_CACHE_MAGIC || header->version != BNR_CACHE_VERSION)
+        return false;
+    if (header->record_size != sizeof(bnr_cache_record_t) || header->bnr_size != bnr_cache_unit_size())
+        return false;
+    if (header->count > max_count)
+        return false;
+
+    return header->crc == tinf_crc32(header, offsetof(bnr_cache_header_t, crc));
+}
+
+static void bnr_cache_make_record(u32 slot, bnr_cache_record_t *record, u32 location) {
+    bnr_cache_entry_t* entry = &bnr_cache[slot];
+
+    memset(record, 0, sizeof(bnr_cache_record_t));
+    if (entry->valid) {
+        memcpy(record->game_id, entry->game_id, 6);
+        record->disc_num = entry->disc_num;
+        record->valid = 1;
+        record->aram_offset = location;
+        record->bnr_crc = entry->bnr_crc;
+        record->pixel_crc = entry->pixel_crc;
+    }
+    record->crc = tinf_crc32(record, offsetof(bnr_cache_record_t, crc));
+}
+
+static bool bnr_cache_record_valid(bnr_cache_record_t *record) {
+    return record->valid && record->crc == tinf_crc32(record, offsetof(bnr_cache_record_t, crc));
+}
+
+static inline u32 bnr_cache_record_offset(u32 slot) {
+    return ARAM_PERSIST_BASE + sizeof(bnr_cache_header_t) + slot * sizeof(bnr_cache_record_t);
+}
+
+static void bnr_cache_write_header() {
+    bnr_cache_header_t *header = (void*)bnr_cache_scratch;
+    bnr_cache_make_header(header, BNR_CACHE_MAX, !bnr_cache_dirty, 0);
+    bnr_cache_dma(&bnr_dma_store, ARAM_DIR_MRAM_TO_ARAM, header, ARAM_PERSIST_BASE, sizeof(bnr_cache_header_t));
+}
+
+static void bnr_cache_write_record(u32 slot) {
+    bnr_cache_record_t *record = (void*)bnr_cache_scratch;
+    bnr_cache_make_record(slot, record, bnr_cache_aram_offset(slot));
+    bnr_cache_dma(&bnr_dma_store, ARAM_DIR_MRAM_TO_ARAM, record, bnr_cache_record_offset(slot), sizeof(bnr_cache_record_t));
+}
+
+// the whole mirror, after a restore moved the slots around
+static void bnr_cache_write_table() {
+    const u32 units = 1 + BNR_CACHE_MAX;
+    const u32 per_chunk = sizeof(bnr_cache_scratch) / sizeof(bnr_cache_record_t);
+
+    for (u32 unit = 0; unit < units; unit += per_chunk) {
+        u32 count = units - unit < per_chunk ? units - unit : per_chunk;
+        for (u32 i = 0; i < count; i++) {
+            void *dst = &bnr_cache_scratch[i * sizeof(bnr_cache_record_t)];
+            if (unit + i == 0) {
+                bnr_cache_make_header(dst, BNR_CACHE_MAX, !bnr_cache_dirty, 0);
+            } else {
+                u32 slot = unit + i - 1;
+                bnr_cache_make_record(slot, dst, bnr_cache_aram_offset(slot));
+            }
         }
+
+        u32 aram_offset = ARAM_PERSIST_BASE + unit * sizeof(bnr_cache_record_t);
+        bnr_cache_dma(&bnr_dma_store, ARAM_DIR_MRAM_TO_ARAM, bnr_cache_scratch, aram_offset, count * sizeof(bnr_cache_record_t));
     }
-    
-    return false;
 }
 
-void bnr_cache_put(u8 game_id[6], BNR* bnr) {
-    for (int i = 0; i < BNR_CACHE_SIZE; i++) {
-        if (bnr_cache[i].valid && memcmp(bnr_cache[i].game_id, game_id, 6) == 0) {
-            return;
+// takes a restored banner into the next slot, the caller placed its block
+static bool bnr_cache_adopt(bnr_cache_record_t *record, u32 aram_offset, u8 check) {
+    u32 slot;
+    if (bnr_cache_count == BNR_CACHE_MAX || game_index_get(&bnr_cache_index, record->game_id, record->disc_num, &slot))
+        return false;
+
+    slot = bnr_cache_count++;
+    bnr_cache_entry_t* entry = &bnr_cache[slot];
+    memcpy(entry->game_id, record->game_id, 6);
+    entry->disc_num = record->disc_num;
+    entry->valid = true;
+    entry->aram_offset = aram_offset;
+    entry->bnr_crc = record->bnr_crc;
+    entry->pixel_crc = record->pixel_crc;
+    entry->referenced = 0;
+    entry->pins = 0;
+    entry->check = check;
+    game_index_put(&bnr_cache_index, entry->game_id, entry->disc_num, slot);
+
+    return true;
+}
+
+// the mirror left by the last session, if nothing overwrote it
+static u32 bnr_cache_restore_aram() {
+    const u32 units = 1 + BNR_CACHE_MAX;
+    const u32 per_chunk = sizeof(bnr_cache_scratch) / sizeof(bnr_cache_record_t);
+
+    u32 restored = 0;
+    for (u32 unit = 0; unit < units; unit += per_chunk) {
+        u32 count = units - unit < per_chunk ? units - unit : per_chunk;
+        u32 aram_offset = ARAM_PERSIST_BASE + unit * sizeof(bnr_cache_record_t);
+        bnr_cache_dma(&bnr_dma_store, ARAM_DIR_ARAM_TO_MRAM, bnr_cache_scratch, aram_offset, count * sizeof(bnr_cache_record_t));
+
+        u32 first = 0;
+        if (unit == 0) {
+            bnr_cache_header_t *header = (void*)bnr_cache_scratch;
+            if (!bnr_cache_header_valid(header, BNR_CACHE_MAX) || header->count != BNR_CACHE_MAX)
+                return 0;
+
+            bnr_cache_dirty = !header->saved;
+            first = 1;
+        }
+
+        for (u32 i = first; i < count; i++) {
+            bnr_cache_record_t *record = (void*)&bnr_cache_scratch[i * sizeof(bnr_cache_record_t)];
+            if (!bnr_cache_record_valid(record)) continue;
+
+            // blocks that someone placed this session are gone
+            u32 block = record->aram_offset;
+            if (!bnr_cache_unit_reserve(block))
+                continue;
+
+            if (bnr_cache_adopt(record, block, BNR_CACHE_CHECK_PIXELS | BNR_CACHE_CHECK_FULL)) {
+                restored++;
+            } else {
+                bnr_cache_unit_free(block);
+            }
+        }
+    }
+
+    return restored;
+}
+
+// Two snapshot files take turns. A save only writes the one that is not
+// the newest valid snapshot, so a save cut short leaves the last good one.
+static const char *bnr_cache_snapshot_paths[2] = { BNR_CACHE_SNAPSHOT_PATH, BNR_CACHE_SNAPSHOT_ALT_PATH };
+
+// the file with the newest valid header, -1 when neither is usable
+static int bnr_cache_snapshot_newest(u32 *generation) {
+    const uint8_t flags = IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_DISABLESPEEDEMU;
+    bnr_cache_header_t *header = (void*)bnr_cache_scratch;
+
+    int newest = -1;
+    for (int i = 0; i < countof(bnr_cache_snapshot_paths); i++) {
+        if (dvd_custom_open(bnr_cache_snapshot_paths[i], FILE_ENTRY_TYPE_FILE, flags) != 0) continue;
+
+        file_status_t *status = dvd_custom_status();
+        if (status == NULL || status->result != 0) {
+            dvd_custom_close(status ? status->fd : 0);
+            continue;
+        }
+
+        u32 file_size = (u32)__builtin_bswap64(*(u64*)(&status->fsize));
+        bool valid = file_size >= sizeof(bnr_cache_header_t) &&
+            dvd_threaded_read(header, sizeof(bnr_cache_header_t), 0, status->fd) == 0 &&
+            bnr_cache_header_valid(header, BNR_CACHE_MAX);
+        dvd_custom_close(status->fd);
+
+        if (valid && (newest < 0 || header->generation > *generation)) {
+            newest = i;
+            *generation = header->generation;
+        }
+    }
+
+    return newest;
+}
+
+// a cold boot, the snapshot is the header, the records, then the banners in record order
+static u32 bnr_cache_load_snapshot() {
+    u32 generation = 0;
+    int file = bnr_cache_snapshot_newest(&generation);
+    if (file < 0) {
+        custom_OSReport("Banner snapshot not found\n");
+        return 0;
+    }
+
+    const uint8_t flags = IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_DISABLESPEEDEMU;
+    if (dvd_custom_open(bnr_cache_snapshot_paths[file], FILE_ENTRY_TYPE_FILE, flags) != 0) {
+        custom_OSReport("Banner snapshot not found\n");
+        return 0;
+    }
+
+    file_status_t *status = dvd_custom_status();
+    if (status == NULL || status->result != 0) {
+        dvd_custom_close(status ? status->fd : 0);
+        return 0;
+    }
+
+    u32 fd = status->fd;
+    u32 file_size = (u32)__builtin_bswap64(*(u64*)(&status->fsize));
+
+    bnr_cache_header_t *header = (void*)bnr_cache_scratch;
+    if (file_size < sizeof(bnr_cache_header_t) || dvd_threaded_read(header, sizeof(bnr_cache_header_t), 0, fd) != 0 ||
+        !bnr_cache_header_valid(header, BNR_CACHE_MAX)) {
+        custom_OSReport("Banner snapshot invalid\n");
+        dvd_custom_close(fd);
+        return 0;
+    }
+
+    u32 count = header->count;
+    u32 unit_size = bnr_cache_unit_size();
+    u32 data_offset = sizeof(bnr_cache_header_t) + count * sizeof(bnr_cache_record_t);
+    if (file_size < data_offset + count * unit_size) {
+        custom_OSReport("Banner snapshot truncated\n");
+        dvd_custom_close(fd);
+        return 0;
+    }
+
+    // records first, they stop at the first broken one so slot i is banner i
+    const u32 per_chunk = sizeof(bnr_cache_scratch) / sizeof(bnr_cache_record_t);
+    u32 adopted = 0;
+    for (u32 start = 0; start < count && adopted == start; start += per_chunk) {
+        u32 chunk = count - start < per_chunk ? count - start : per_chunk;
+        u32 offset = sizeof(bnr_cache_header_t) + start * sizeof(bnr_cache_record_t);
+        if (dvd_threaded_read(bnr_cache_scratch, chunk * sizeof(bnr_cache_record_t), offset, fd) != 0)
+            break;
+
+        for (u32 i = 0; i < chunk; i++) {
+            bnr_cache_record_t *record = (void*)&bnr_cache_scratch[i * sizeof(bnr_cache_record_t)];
+            if (!bnr_cache_record_valid(record) || record->aram_offset != start + i) break;
+
+            u32 block = bnr_cache_unit_alloc();
+            if (block == ARAM_NONE) break;
+            if (!bnr_cache_adopt(record, block, 0)) {
+                bnr_cache_unit_free(block);
+                break;
+            }
+            adopted++;
+        }
+    }
+
+    // then the banners, straight through into their blocks
+    u32 restored = 0;
+    for (u32 slot = 0; slot < adopted; slot++) {
+        bnr_cache_entry_t* entry = &bnr_cache[slot];
+        BNR *bnr = (void*)bnr_cache_scratch;
+
+        bool ok = dvd_threaded_read(bnr, unit_size, data_offset + slot * unit_size, fd) == 0;
+        if (ok && tinf_crc32(bnr, unit_size) == entry->bnr_crc) {
+            bnr_cache_store(bnr, entry->aram_offset, unit_size);
+            restored++;
+        } else {
+            // keeps its block, the next put takes the slot
+            game_index_remove(&bnr_cache_index, entry->game_id, entry->disc_num);
+            entry->valid = false;
+        }
+    }
+
+    dvd_custom_close(fd);
+    return restored;
+}
+
+void bnr_cache_init() {
+    if (bnr_cache_index_ready) return;
+
+    u64 start_time = gettime();
+    game_index_init(&bnr_cache_index, bnr_cache_index_slots, BNR_CACHE_MAX * 2);
+
+    const char *source = "ARAM";
+    u32 restored = bnr_cache_restore_aram();
+    if (restored == 0 && bnr_snapshot_enabled) {
+        source = "SD";
+        restored = bnr_cache_load_snapshot();
+        bnr_cache_dirty = false;
+    }
+
+    // whatever is left once swiss and the directory cache are placed
+    bnr_cache_capacity = bnr_cache_count + bnr_cache_unit_room();
+    if (bnr_cache_capacity > BNR_CACHE_MAX) bnr_cache_capacity = BNR_CACHE_MAX;
+
+    // the mirror follows every put from here on
+    bnr_cache_write_table();
+    bnr_cache_index_ready = true;
+
+    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
+    custom_OSReport("Banner cache capacity %u (%u bytes each), restored %u from %s, took=%f\n",
+        bnr_cache_capacity, bnr_cache_unit_size(), restored, source, runtime);
+    (void)source;
+    (void)runtime;
+}
+
+// restored banners are checked on their first load, a game may have used the ARAM since
+static bool bnr_cache_check(u32 slot, u8 check, const void* data, u32 length) {
+    bnr_cache_entry_t* entry = &bnr_cache[slot];
+    if ((entry->check & check) == 0)
+        return true;
+
+    u32 expected = (check & BNR_CACHE_CHECK_FULL) ? entry->bnr_crc : entry->pixel_crc;
+    bool ok = tinf_crc32(data, length) == expected;
+
+    BOOL enabled = OSDisableInterrupts();
+    if (ok) {
+        entry->check &= ~check;
+    } else if (entry->valid) {
+        custom_OSReport("Dropping stale banner in slot %u\n", slot);
+        game_index_remove(&bnr_cache_index, entry->game_id, entry->disc_num);
+        entry->valid = false;
+        bnr_cache_epoch++;
+        entry->referenced = 0;
+    }
+    OSRestoreInterrupts(enabled);
+
+    return ok;
+}
+
+// the asset loader reads while the enum thread fills, index access is atomic
+static bool bnr_cache_find(u8 game_id[6], u8 disc_num, u32 *slot) {
+    BOOL enabled = OSDisableInterrupts();
+    bool found = bnr_cache_index_ready && game_index_get(&bnr_cache_index, game_id, disc_num, slot);
+    if (found) {
+        bnr_cache[*slot].referenced = 1;
+        bnr_cache_hits++;
+    } else {
+        bnr_cache_misses++;
+    }
+    OSRestoreInterrupts(enabled);
+
+    return found;
+}
+
+bool bnr_cache_get(u8 game_id[6], u8 disc_num, BNR* bnr) {
+    u32 slot;
+    if (!bnr_cache_find(game_id, disc_num, &slot))
+        return false;
+
+    u32 length = bnr_cache_unit_size();
+    bnr_cache_load_range(bnr, bnr_cache_aram_offset(slot), length);
+    if (!bnr_cache_check(slot, BNR_CACHE_CHECK_FULL | BNR_CACHE_CHECK_PIXELS, bnr, length))
+        return false;
+
+    // a compact banner only kept the first description
+    for (int i = 1; length < sizeof(BNR) && i < countof(bnr->desc); i++) {
+        memcpy(&bnr->desc[i], &bnr->desc[0], sizeof(BNRDesc));
+    }
+    return true;
+}
+
+// the pixel data and the first description behind it (BNR_PIXELS_DESC_LEN),
+// straight into a 32 byte aligned texture buffer
+bool bnr_cache_get_pixels(u8 game_id[6], u8 disc_num, void* pixels) {
+    u32 aram_offset;
+    if (!bnr_cache_pixels_at(game_id, disc_num, &aram_offset))
+        return false;
+
+    bnr_cache_load_range(pixels, aram_offset, BNR_PIXELS_DESC_LEN);
+    return bnr_cache_pixels_loaded(game_id, disc_num, pixels);
+}
+
+// the two halves of bnr_cache_get_pixels, for callers that batch the transfers
+bool bnr_cache_pixels_at(u8 game_id[6], u8 disc_num, u32 *aram_offset) {
+    u32 slot;
+    if (!bnr_cache_find(game_id, disc_num, &slot))
+        return false;
+
+    *aram_offset = bnr_cache_aram_offset(slot) + offsetof(BNR, pixelData);
+    return true;
+}
+
+bool bnr_cache_pixels_loaded(u8 game_id[6], u8 disc_num, void* pixels) {
+    BOOL enabled = OSDisableInterrupts();
+    u32 slot;
+    bool found = bnr_cache_index_ready && game_index_get(&bnr_cache_index, game_id, disc_num, &slot);
+    OSRestoreInterrupts(enabled);
+    if (!found)
+        return false;
+
+    return bnr_cache_check(slot, BNR_CACHE_CHECK_PIXELS, pixels, BNR_PIXELDATA_LEN);
+}
+
+// on screen banners are never evicted, pins nest
+void bnr_cache_pin(u8 game_id[6], u8 disc_num, bool pin) {
+    BOOL enabled = OSDisableInterrupts();
+    u32 slot;
+    if (bnr_cache_index_ready && game_index_get(&bnr_cache_index, game_id, disc_num, &slot)) {
+        bnr_cache_entry_t* entry = &bnr_cache[slot];
+        if (pin) {
+            entry->pins++;
+        } else if (entry->pins > 0) {
+            entry->pins--;
         }
     }
+    OSRestoreInterrupts(enabled);
+}
+
+// nothing is on screen any more, the listing was dropped
+void bnr_cache_unpin_all() {
+    BOOL enabled = OSDisableInterrupts();
+    for (u32 i = 0; i < bnr_cache_count; i++) {
+        bnr_cache[i].pins = 0;
+    }
+    OSRestoreInterrupts(enabled);
+}
+
+// a slot for a new banner, BNR_CACHE_MAX when everything is pinned
+static u32 bnr_cache_victim() {
+    // grow while the free ARAM allows it
+    if (bnr_cache_count < bnr_cache_capacity) {
+        u32 offset = bnr_cache_unit_alloc();
+        if (offset != ARAM_NONE) {
+            bnr_cache[bnr_cache_count].aram_offset = offset;
+            return bnr_cache_count++;
+        }
+
+        // someone else took the space since the capacity was set
+        bnr_cache_capacity = bnr_cache_count;
+        if (bnr_cache_count == 0) return BNR_CACHE_MAX;
+    }
+
+    // two sweeps clear every second chance bit
+    for (u32 i = 0; i < bnr_cache_count * 2; i++) {
+        u32 slot = bnr_cache_hand;
+        bnr_cache_hand = (bnr_cache_hand + 1) % bnr_cache_count;
+
+        bnr_cache_entry_t* entry = &bnr_cache[slot];
+        if (entry->pins > 0) continue;
+        if (entry->referenced) {
+            entry->referenced = 0;
+            continue;
+        }
+
+        return slot;
+    }
+
+    return BNR_CACHE_MAX;
+}
+
+void bnr_cache_put(u8 game_id[6], u8 disc_num, BNR* bnr) {
+    if (!bnr_cache_index_ready)
+        return;
+
+    // callers serialise puts (the card mutex), only readers need keeping out
+    u32 slot;
+    if (game_index_get(&bnr_cache_index, game_id, disc_num, &slot))
+        return;
+
+    BOOL enabled = OSDisableInterrupts();
+    slot = bnr_cache_victim();
+    if (slot == BNR_CACHE_MAX) {
+        OSRestoreInterrupts(enabled);
+        return;
+    }
+
+    bnr_cache_entry_t* entry = &bnr_cache[slot];
+    if (entry->valid) {
+        game_index_remove(&bnr_cache_index, entry->game_id, entry->disc_num);
+        bnr_cache_evictions++;
+    }
 
-    bnr_cache_entry_t* entry = &bnr_cache[bnr_cache_next_index];
     entry->valid = false;
+    bnr_cache_epoch++;
     memcpy(entry->game_id, game_id, 6);
-    entry->aram_offset = (16 * 1024 * 1024) - (sizeof(BNR) * (bnr_cache_next_index + 1));
-    bnr_cache_store(bnr, entry->aram_offset);
+    entry->disc_num = disc_num;
+    entry->referenced = 1;
+    entry->pins = 0;
+    entry->check = 0;
+    OSRestoreInterrupts(enabled);
+
+    entry->bnr_crc = tinf_crc32(bnr, bnr_cache_unit_size());
+    entry->pixel_crc = tinf_crc32(bnr->pixelData, BNR_PIXELDATA_LEN);
+    bnr_cache_store(bnr, bnr_cache_aram_offset(slot), bnr_cache_unit_size());
+
+    enabled = OSDisableInterrupts();
     entry->valid = true;
-    
-    bnr_cache_next_index = (bnr_cache_next_index + 1) % BNR_CACHE_SIZE;
+    game_index_put(&bnr_cache_index, game_id, disc_num, slot);
+    OSRestoreInterrupts(enabled);
+
+    // the ARAM mirror, the header only changes when the snapshot goes stale
+    bnr_cache_write_record(slot);
+    if (!bnr_cache_dirty) {
+        bnr_cache_dirty = true;
+        bnr_cache_write_header();
+    }
+}
+
+// opens a snapshot file for writing, -1 on failure, callers hold the card mutex
+static int bnr_cache_save_open(const char *path) {
+    if (dvd_custom_open(path, FILE_ENTRY_TYPE_FILE, IPC_FILE_FLAG_DISABLESPEEDEMU | IPC_FILE_FLAG_WRITE) != 0)
+        return -1;
+
+    file_status_t *status = dvd_custom_status();
+    if (status == NULL || status->result != 0) {
+        dvd_custom_close(status ? status->fd : 0);
+        return -1;
+    }
+
+    return status->fd;
+}
+
+// a slot change (put, stale drop) or a cancel since the save started
+static bool bnr_cache_save_stopped(u32 epoch) {
+    BOOL enabled = OSDisableInterrupts();
+    bool stopped = bnr_cache_epoch != epoch || gm_enum_cancelled();
+    OSRestoreInterrupts(enabled);
+
+    return stopped;
+}
+
+#define BNR_CACHE_SAVE_SLICE 16 // banners per card mutex hold
+
+// Writes the snapshot for the next cold boot into the older of the two files.
+// Callers must not hold the card mutex. The card has a single file handle,
+// so the file is opened again for every slice of banners and the asset
+// loader gets the card in between. A put or a cancel in between ends the
+// save early, the newest snapshot stays as it was and the cache stays dirty
+// for the next save.
+void bnr_cache_save() {
+    if (!bnr_snapshot_enabled || !bnr_cache_index_ready || !bnr_cache_dirty) return;
+    if (gm_enum_cancelled()) return;
+
+    u64 start_time = gettime();
+    gm_card_lock();
+
+    u32 generation = 0;
+    int newest = bnr_cache_snapshot_newest(&generation);
+    const char *path = bnr_cache_snapshot_paths[newest == 0 ? 1 : 0];
+
+    dvd_custom_mkdir(BNR_CACHE_DIR);
+    int fd = bnr_cache_save_open(path);
+    if (fd < 0) {
+        gm_card_unlock();
+        custom_OSReport("ERROR: Failed to open %s\n", path);
+        return;
+    }
+    u32 epoch = bnr_cache_epoch;
+
+    u32 count = 0;
+    for (u32 slot = 0; slot < bnr_cache_count; slot++) {
+        if (bnr_cache[slot].valid) count++;
+    }
+
+    // this file is not the newest one, it can go invalid until the header is written
+    bnr_cache_header_t *header = (void*)bnr_cache_scratch;
+    memset(header, 0, sizeof(bnr_cache_header_t));
+    bool ok = dvd_custom_write((char*)header, 0, sizeof(bnr_cache_header_t), fd) == 0;
+
+    // records, dense and in slot order
+    const u32 per_chunk = sizeof(bnr_cache_scratch) / sizeof(bnr_cache_record_t);
+    u32 index = 0;
+    u32 chunk = 0;
+    for (u32 slot = 0; ok && slot <= bnr_cache_count; slot++) {
+        bool flush = slot == bnr_cache_count || chunk == per_chunk;
+        if (flush && chunk > 0) {
+            u32 offset = sizeof(bnr_cache_header_t) + (index - chunk) * sizeof(bnr_cache_record_t);
+            ok = dvd_custom_write((char*)bnr_cache_scratch, offset, chunk * sizeof(bnr_cache_record_t), fd) == 0;
+            chunk = 0;
+        }
+        if (slot == bnr_cache_count || !bnr_cache[slot].valid) continue;
+
+        bnr_cache_make_record(slot, (void*)&bnr_cache_scratch[chunk * sizeof(bnr_cache_record_t)], index);
+        chunk++;
+        index++;
+    }
+    dvd_custom_close(fd);
+    gm_card_unlock();
+
+    // then the banners, through the same buffer
+    u32 unit_size = bnr_cache_unit_size();
+    u32 data_offset = sizeof(bnr_cache_header_t) + count * sizeof(bnr_cache_record_t);
+    bool stopped = false;
+    u32 slot = 0;
+    index = 0;
+    while (ok && slot < bnr_cache_count) {
+        if (bnr_cache_save_stopped(epoch)) {
+            stopped = true;
+            break;
+        }
+
+        gm_card_lock();
+        fd = bnr_cache_save_open(path);
+        ok = fd >= 0;
+        for (u32 written = 0; ok && written < BNR_CACHE_SAVE_SLICE && slot < bnr_cache_count; slot++) {
+            // a stale banner drop clears valid without the card mutex
+            BOOL enabled = OSDisableInterrupts();
+            stopped = bnr_cache_epoch != epoch;
+            bool valid = bnr_cache[slot].valid;
+            OSRestoreInterrupts(enabled);
+            if (stopped) break;
+            if (!valid) continue;
+
+            bnr_cache_dma(&bnr_dma_store, ARAM_DIR_ARAM_TO_MRAM, bnr_cache_scratch, bnr_cache_aram_offset(slot), unit_size);
+            ok = dvd_custom_write((char*)bnr_cache_scratch, data_offset + index * unit_size, unit_size, fd) == 0;
+            index++;
+            written++;
+        }
+        if (fd >= 0) dvd_custom_close(fd);
+        gm_card_unlock();
+
+        if (stopped) break;
+    }
+
+    // the header makes it the newest snapshot
+    gm_card_lock();
+    stopped = stopped || bnr_cache_save_stopped(epoch);
+    if (ok && !stopped) {
+        fd = bnr_cache_save_open(path);
+        ok = fd >= 0;
+        if (ok) {
+            bnr_cache_make_header(header, count, true, generation + 1);
+            ok = dvd_custom_write((char*)header, 0, sizeof(bnr_cache_header_t), fd) == 0;
+            dvd_custom_close(fd);
+        }
+    }
+
+    if (ok && !stopped) {
+        bnr_cache_dirty = false;
+        bnr_cache_write_header();
+    }
+    gm_card_unlock();
+
+    if (!ok) {
+        custom_OSReport("ERROR: Failed to write %s\n", path);
+        return;
+    }
+    if (stopped) {
+        custom_OSReport("Banner snapshot save stopped, the previous one is kept\n");
+        return;
+    }
+
+    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
+    custom_OSReport("Banner snapshot save took=%f (%u banners)\n", runtime, count);
+    (void)runtime;
+}
+
+void bnr_cache_report() {
+    u32 pinned = 0;
+    for (u32 i = 0; i < bnr_cache_count; i++) {
+        if (bnr_cache[i].pins > 0) pinned++;
+    }
+
+    custom_OSReport("Banner cache: %u/%u slots, %u pinned, hits=%u misses=%u evictions=%u\n",
+        bnr_cache_count, bnr_cache_capacity, pinned, bnr_cache_hits, bnr_cache_misses, bnr_cache_evictions);
+    (void)pinned;
 }
 
 #else
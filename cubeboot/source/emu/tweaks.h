@@ -1,6 +1,7 @@
 #ifndef TWEAKS_H
 #define TWEAKS_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #ifdef IPL_CODE
@@ -19,8 +20,22 @@ bool emu_can_boot(gm_file_type_t type);
 void emu_draw_boot_error(gm_file_type_t type, u8 ui_alpha);
 bool emu_has_dvd();
 
-bool bnr_cache_get(u8 game_id[6], BNR* bnr);
-void bnr_cache_put(u8 game_id[6], BNR* bnr);
+bool swiss_probe();
+void swiss_preload_aram();
+
+// pixels through the first description, what the menu keeps of a banner
+#define BNR_PIXELS_DESC_LEN (offsetof(BNR, desc[1]) - offsetof(BNR, pixelData))
+
+void bnr_cache_init();
+void bnr_cache_save();
+bool bnr_cache_get(u8 game_id[6], u8 disc_num, BNR* bnr);
+bool bnr_cache_get_pixels(u8 game_id[6], u8 disc_num, void* pixels);
+bool bnr_cache_pixels_at(u8 game_id[6], u8 disc_num, u32 *aram_offset);
+bool bnr_cache_pixels_loaded(u8 game_id[6], u8 disc_num, void* pixels);
+void bnr_cache_put(u8 game_id[6], u8 disc_num, BNR* bnr);
+void bnr_cache_pin(u8 game_id[6], u8 disc_num, bool pin);
+void bnr_cache_unpin_all();
+void bnr_cache_report();
 
 #else
 void ensure_ipl_loaded(uint8_t* bios_buffer);
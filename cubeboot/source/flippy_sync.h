@@ -48,6 +48,7 @@ int dvd_custom_status(file_status_t* status);
 int dvd_custom_fs_info(fs_info_t* status);
 int dvd_custom_status_flash(file_status_t *dst);
 int dvd_custom_readdir(file_entry_t *dst, uint32_t fd);
+int dvd_custom_readdir_header(file_entry_t *dst, void *header, uint32_t header_len, uint32_t *header_read, uint32_t fd);
 int dvd_custom_unlink(char *path);
 int dvd_custom_unlink_flash(char *path);
 int dvd_custom_mkdir(char *path);
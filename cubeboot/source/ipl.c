@@ -185,6 +185,7 @@ void load_ipl(bool is_running_dolphin) {
     iprintf("\tCode size: %x\n", blob_metadata->code_size);
     iprintf("\tCode checksum: %x\n", blob_metadata->code_checksum);
 
+    // the IPL side keeps this window out of its allocator (ARAM_STAGE_BASE)
     ARAMFetch((void*)BS2_BASE_ADDR, (void*)0xe00000, 0x200000);
 
     extern void ensure_ipl_loaded(uint8_t* bios_buffer);
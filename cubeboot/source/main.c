@@ -38,6 +38,7 @@
 
 #include "flippy_sync.h"
 #include "sram.h"
+#include "trace.h"
 
 #define DEFAULT_FIFO_SIZE (256 * 1024)
 
@@ -64,7 +65,7 @@ int main(int argc, char **argv) {
     u64 startts, endts;
 
     startts = ticks_to_millisecs(gettime());
-
+    trace_begin(TRACE_CUBEBOOT);
 
     Elf32_Ehdr* ehdr;
     Elf32_Shdr* shdr;
@@ -168,7 +169,9 @@ int main(int argc, char **argv) {
 
     // setup settings
     iprintf("Loading settings\n");
+    trace_begin(TRACE_SETTINGS_LOAD);
     load_settings();
+    trace_end(TRACE_SETTINGS_LOAD, 0);
 
     // fix sram
     set_sram_swiss(true);
@@ -178,7 +181,9 @@ int main(int argc, char **argv) {
 
     // load ipl
     bool is_running_dolphin = is_dolphin();
+    trace_begin(TRACE_IPL_LOAD);
     load_ipl(is_running_dolphin);
+    trace_end(TRACE_IPL_LOAD, current_bios->version);
 
     // disable progressive on unsupported IPLs
     if (current_bios->version == IPL_NTSC_10) {
@@ -199,6 +204,7 @@ int main(int argc, char **argv) {
     char *reloc_region = current_bios->reloc_prefix;
 
     // Patch each appropriate section
+    trace_begin(TRACE_PATCH_APPLY);
     for (int i = 0; i < ehdr->e_shnum; ++i) {
         shdr = (Elf32_Shdr *)(addr + ehdr->e_shoff + (i * sizeof(Elf32_Shdr)));
 
@@ -308,6 +314,9 @@ int main(int argc, char **argv) {
 
     set_patch_value(symshdr, syment, symstringdata, "preboot_delay_ms", settings.preboot_delay_ms);
     set_patch_value(symshdr, syment, symstringdata, "postboot_delay_ms", settings.postboot_delay_ms);
+    set_patch_value(symshdr, syment, symstringdata, "trace_dump_target", settings.trace_dump);
+    set_patch_value(symshdr, syment, symstringdata, "bnr_snapshot_enabled", settings.banner_snapshot);
+    set_patch_value(symshdr, syment, symstringdata, "bnr_compact_enabled", settings.banner_compact);
 
     // // Copy settings string
     // void *cube_logo_ptr = (void*)get_symbol_value(symshdr, syment, symstringdata, "cube_logo_path");
@@ -329,6 +338,7 @@ int main(int argc, char **argv) {
 #endif
 
     iprintf("Patches applied\n");
+    trace_end(TRACE_PATCH_APPLY, 0);
 
     /*** Shutdown libOGC ***/
     GX_AbortFrame();
@@ -351,6 +361,10 @@ int main(int argc, char **argv) {
     u64 runtime = endts - startts;
     iprintf("Runtime = %llu\n", runtime);
 
+    // hand the timeline over to the IPL
+    trace_end(TRACE_CUBEBOOT, 0);
+    trace_handoff((trace_ring_t*)get_symbol_value(symshdr, syment, symstringdata, "trace_ring"));
+
     __lwp_thread_stopmultitasking(bs2entry);
 
     __builtin_unreachable();
@@ -113,6 +113,33 @@ void load_settings() {
         settings.postboot_delay_ms = postboot_delay_ms;
     }
 
+    // boot trace dump (0 = off, 1 = sd, 2 = usb gecko)
+    u32 trace_dump = 0;
+    if (!ini_sget(conf, "cubeboot", "trace_dump", "%u", &trace_dump)) {
+        settings.trace_dump = 0;
+    } else {
+        iprintf("Found trace_dump = %u\n", trace_dump);
+        settings.trace_dump = trace_dump;
+    }
+
+    // banner cache snapshot on SD for cold boots
+    u32 banner_snapshot = 0;
+    if (!ini_sget(conf, "cubeboot", "banner_snapshot", "%u", &banner_snapshot)) {
+        settings.banner_snapshot = 0;
+    } else {
+        iprintf("Found banner_snapshot = %u\n", banner_snapshot);
+        settings.banner_snapshot = banner_snapshot;
+    }
+
+    // banner cache keeps only the pixels and the shown description
+    u32 banner_compact = 0;
+    if (!ini_sget(conf, "cubeboot", "banner_compact", "%u", &banner_compact)) {
+        settings.banner_compact = 0;
+    } else {
+        iprintf("Found banner_compact = %u\n", banner_compact);
+        settings.banner_compact = banner_compact;
+    }
+
     // show_watermark
     int show_watermark = 0;
     if (!ini_sget(conf, "cubeboot", "show_watermark", "%d", &show_watermark)) {
@@ -11,6 +11,9 @@ typedef struct settings {
     u32 progressive_enabled;
     u32 preboot_delay_ms;
     u32 postboot_delay_ms;
+    u32 trace_dump;
+    u32 banner_snapshot;
+    u32 banner_compact;
     char *default_program;
     char *boot_buttons[MAX_BUTTONS];
 } settings_t;
@@ -0,0 +1,27 @@
+#include <string.h>
+
+#include <ogcsys.h>
+#include <ogc/lwp_watchdog.h>
+
+#include "trace.h"
+
+trace_ring_t trace_ring = {
+    .magic = TRACE_MAGIC,
+};
+
+// cubeboot runs single threaded, no locking needed here
+void trace_event(u16 event, u8 phase, u32 arg) {
+    trace_record_t *rec = &trace_ring.records[trace_ring.head++ & (TRACE_RING_SIZE - 1)];
+    rec->time = gettime();
+    rec->event = event;
+    rec->phase = phase;
+    rec->thread = 0;
+    rec->arg = arg;
+}
+
+// must run after the patch sections are copied, they carry an empty ring
+void trace_handoff(trace_ring_t *dst) {
+    if (dst == NULL) return;
+    memcpy(dst, &trace_ring, sizeof(trace_ring_t));
+    DCFlushRange(dst, sizeof(trace_ring_t));
+}
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+
+# Sizes the banner cache formats (`banner_compact`) against real banners.
+# Takes opening.bnr files or .iso/.gcm dumps and reports how many banners a
+# megabyte of ARAM holds as whole BNRs, as compact records, and with the
+# pixels run length or zlib compressed. The pixels are DMAed straight into
+# texture buffers today, so compression only pays if decoding a banner on the
+# console is faster than the DMA it saves. With --dma-mbps (measured ARAM to
+# MRAM throughput) the saved DMA time per banner is printed as that budget,
+# next to the decode time of both formats measured on this host. Every
+# encoded banner is decoded again and compared, so the numbers are only
+# printed for a lossless round trip. zlib decodes in C but the rle decoder
+# is plain Python, so its time overstates what a C decoder would take.
+# --cpu-ratio scales both by how much slower the console is than this host.
+#
+#   scripts/bnr-compact.py --dma-mbps <measured> dumps/*.iso
+
+import sys
+import zlib
+import struct
+import timeit
+import argparse
+
+BNR_HEADER_LEN = 0x20
+BNR_PIXELDATA_LEN = 96 * 32 * 2
+BNR_DESC_LEN = 0x140
+BNR_LEN = BNR_HEADER_LEN + BNR_PIXELDATA_LEN + 6 * BNR_DESC_LEN
+BNR_COMPACT_LEN = BNR_HEADER_LEN + BNR_PIXELDATA_LEN + BNR_DESC_LEN
+
+# keep in sync with the banner cache in emu/tweaks.c and aram.h
+ARAM_BLOCK_SIZE = 8 * 1024
+BNR_CACHE_PAGE_SIZE = 64 * 1024
+
+DISK_HEADER_SIZE = 0x440
+DVD_MAGIC = 0xC2339F3D
+FST_ENTRY_SIZE = 12
+
+def read_disc_banner(f):
+    header = f.read(DISK_HEADER_SIZE)
+    fst_offset, fst_size = struct.unpack_from('>II', header, 0x424)
+    f.seek(fst_offset)
+    fst = f.read(fst_size)
+
+    total = struct.unpack_from('>I', fst, 8)[0]
+    strings = total * FST_ENTRY_SIZE
+    i = 1
+    while i < total:
+        word, addr, length = struct.unpack_from('>III', fst, i * FST_ENTRY_SIZE)
+        if word >> 24 != 0:
+            i = length # only the root one counts, like in the IPL
+            continue
+
+        name_offset = strings + (word & 0xFFFFFF)
+        name = fst[name_offset:fst.index(b'\0', name_offset)]
+        if name.lower() == b'opening.bnr':
+            f.seek(addr)
+            return f.read(min(length, BNR_LEN))
+        i += 1
+
+    raise ValueError('no opening.bnr in the FST')
+
+def read_banner(path):
+    with open(path, 'rb') as f:
+        magic = f.read(4)
+        f.seek(0)
+        if magic in (b'BNR1', b'BNR2'):
+            data = f.read(BNR_LEN)
+        elif struct.unpack_from('>I', f.read(0x20), 0x1C)[0] == DVD_MAGIC:
+            f.seek(0)
+            data = read_disc_banner(f)
+        else:
+            raise ValueError('not a banner or a GameCube disc image')
+
+    if len(data) < BNR_COMPACT_LEN or data[:3] != b'BNR':
+        raise ValueError('banner is truncated or has a bad magic')
+
+    return data
+
+# one control byte per run, < 0x80 is n + 1 literal pixels, else n - 0x7F copies of one pixel
+def rle_encode(pixels):
+    words = [pixels[i:i + 2] for i in range(0, len(pixels), 2)]
+    out = bytearray()
+    literals = []
+
+    def flush():
+        while literals:
+            chunk = literals[:0x80]
+            del literals[:0x80]
+            out.append(len(chunk) - 1)
+            out.extend(b''.join(chunk))
+
+    i = 0
+    while i < len(words):
+        run = 1
+        while i + run < len(words) and run < 0x80 and words[i + run] == words[i]:
+            run += 1
+
+        if run >= 3:
+            flush()
+            out.append(0x7F + run)
+            out.extend(words[i])
+        else:
+            literals.extend(words[i:i + run])
+        i += run
+
+    flush()
+    return bytes(out)
+
+def rle_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        control = data[i]
+        if control < 0x80:
+            length = (control + 1) * 2
+            out += data[i + 1:i + 1 + length]
+            i += 1 + length
+        else:
+            out += data[i + 1:i + 3] * (control - 0x7F)
+            i += 3
+    return bytes(out)
+
+# best of a few rounds, in microseconds per decode
+def decode_usec(decode, data, number):
+    rounds = timeit.repeat(lambda: decode(data), number=number, repeat=5)
+    return min(rounds) / number * 1000000
+
+def round_up(value, align):
+    return (value + align - 1) // align * align
+
+def per_mb_blocks(size):
+    block = ARAM_BLOCK_SIZE
+    while block < size:
+        block *= 2
+    return (1024 * 1024) // block
+
+def per_mb_packed(size):
+    return (1024 * 1024 // BNR_CACHE_PAGE_SIZE) * (BNR_CACHE_PAGE_SIZE // round_up(int(size), 32))
+
+def main():
+    parser = argparse.ArgumentParser(description='Size the banner cache formats against real banners')
+    parser.add_argument('paths', nargs='+', help='opening.bnr files or .iso/.gcm dumps')
+    parser.add_argument('--dma-mbps', type=float, help='measured ARAM DMA throughput in MB/s')
+    parser.add_argument('--cpu-ratio', type=float, default=1.0, help='how many times slower the console decodes than this host')
+    parser.add_argument('--number', type=int, default=50, help='decodes per timing round')
+    parser.add_argument('-v', '--verbose', action='store_true', help='print every banner')
+    args = parser.parse_args()
+
+    rows = []
+    for path in args.paths:
+        try:
+            data = read_banner(path)
+        except (OSError, ValueError, struct.error) as e:
+            print(f'skipping {path}: {e}', file=sys.stderr)
+            continue
+
+        pixels = data[BNR_HEADER_LEN:BNR_HEADER_LEN + BNR_PIXELDATA_LEN]
+        rle_data = rle_encode(pixels)
+        lz_data = zlib.compress(pixels, 1)
+        if rle_decode(rle_data) != pixels or zlib.decompress(lz_data) != pixels:
+            print(f'{path}: round trip failed', file=sys.stderr)
+            return 1
+
+        rle = BNR_COMPACT_LEN - BNR_PIXELDATA_LEN + len(rle_data)
+        lz = BNR_COMPACT_LEN - BNR_PIXELDATA_LEN + len(lz_data)
+        rle_us = decode_usec(rle_decode, rle_data, args.number) * args.cpu_ratio
+        lz_us = decode_usec(zlib.decompress, lz_data, args.number) * args.cpu_ratio
+        rows.append((path, rle, lz, rle_us, lz_us))
+
+        if args.verbose:
+            print(f'{path}: rle {rle} bytes {rle_us:.1f}us, zlib {lz} bytes {lz_us:.1f}us')
+
+    if not rows:
+        print('no banners', file=sys.stderr)
+        return 1
+
+    rle_avg = sum(r[1] for r in rows) / len(rows)
+    lz_avg = sum(r[2] for r in rows) / len(rows)
+    rle_worst = max(r[1] for r in rows)
+    lz_worst = max(r[2] for r in rows)
+    rle_us = sum(r[3] for r in rows) / len(rows)
+    lz_us = sum(r[4] for r in rows) / len(rows)
+
+    print(f'{len(rows)} banners, banners per MB of ARAM:')
+    print(f'\tfull     {BNR_LEN:6} bytes  {per_mb_blocks(BNR_LEN):4} (one block each)')
+    print(f'\tcompact  {BNR_COMPACT_LEN:6} bytes  {per_mb_packed(BNR_COMPACT_LEN):4} (packed into pages)')
+    print(f'\trle      {rle_avg:6.0f} bytes  {per_mb_packed(rle_avg):4} on average, {per_mb_packed(rle_worst)} at the worst banner')
+    print(f'\tzlib -1  {lz_avg:6.0f} bytes  {per_mb_packed(lz_avg):4} on average, {per_mb_packed(lz_worst)} at the worst banner')
+
+    print(f'decode time per banner (x{args.cpu_ratio:g} of this host):')
+    print(f'\trle      {rle_us:6.1f}us')
+    print(f'\tzlib -1  {lz_us:6.1f}us')
+
+    if args.dma_mbps:
+        def usec(size):
+            return size / (args.dma_mbps * 1024 * 1024) * 1000000
+
+        def verdict(saved, decode):
+            return 'pays' if decode < saved else 'does not pay'
+
+        full = usec(BNR_PIXELDATA_LEN)
+        rle_saved = full - usec(rle_avg - (BNR_COMPACT_LEN - BNR_PIXELDATA_LEN))
+        lz_saved = full - usec(lz_avg - (BNR_COMPACT_LEN - BNR_PIXELDATA_LEN))
+        print(f'pixel DMA takes {full:.1f}us per banner, DMA saved against decode:')
+        print(f'\trle      {rle_saved:6.1f}us saved, {rle_us:6.1f}us decode, {verdict(rle_saved, rle_us)}')
+        print(f'\tzlib -1  {lz_saved:6.1f}us saved, {lz_us:6.1f}us decode, {verdict(lz_saved, lz_us)}')
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+
+# Generates source/bnr_offsets.c, the table of known opening.bnr offsets the
+# IPL uses to skip reading the FST. Keys are the crc32 of the disc header
+# (the first 0x440 bytes, what `DiskHeader` covers), so regenerating only
+# needs plain .iso/.gcm dumps:
+#
+#   scripts/bnr-offsets.py --merge source/bnr_offsets.c -o source/bnr_offsets.c dumps/*.iso
+#   scripts/bnr-offsets.py --list dumps.txt -o source/bnr_offsets.c
+#
+# The output is sorted by hash for the binary search in get_banner_offset_fast.
+
+import re
+import sys
+import zlib
+import struct
+import argparse
+
+DISK_HEADER_SIZE = 0x440
+DVD_MAGIC = 0xC2339F3D
+FST_ENTRY_SIZE = 12
+
+output_template = '''// Generated by scripts/bnr-offsets.py, do not edit.
+// {count} discs, keyed by the crc32 of the disc header and sorted by it.
+
+#include <gctypes.h>
+
+#include "crc32.h"
+#include "dolphin_dvd.h"
+
+#include "reloc.h"
+
+#define BNR_OFFSETS_COUNT {count}
+
+// parallel arrays, the search only walks the hashes
+static const u32 bnr_offset_hashes[BNR_OFFSETS_COUNT] = {{
+{hashes}
+}};
+
+static const u32 bnr_offset_values[BNR_OFFSETS_COUNT] = {{
+{values}
+}};
+
+u32	get_banner_offset_fast(DiskHeader *header) {{
+	if (header->DOLOffset == 0) return 0; // skip Datel discs
+
+	u32 hash = tinf_crc32((u8*)header, sizeof(DiskHeader));
+	// hash += 1; // test only
+
+	u32 low = 0;
+	u32 high = BNR_OFFSETS_COUNT;
+	while (low < high) {{
+		u32 mid = (low + high) / 2;
+		if (bnr_offset_hashes[mid] < hash) {{
+			low = mid + 1;
+		}} else {{
+			high = mid;
+		}}
+	}}
+
+	if (low < BNR_OFFSETS_COUNT && bnr_offset_hashes[low] == hash)
+		return bnr_offset_values[low];
+
+	return 0;
+}}
+'''
+
+def read_banner_offset(path):
+    with open(path, 'rb') as f:
+        header = f.read(DISK_HEADER_SIZE)
+        if len(header) != DISK_HEADER_SIZE:
+            raise ValueError('too short for a disc header')
+
+        magic = struct.unpack_from('>I', header, 0x1C)[0]
+        if magic != DVD_MAGIC:
+            raise ValueError('not a GameCube disc image (.iso/.gcm)')
+
+        dol_offset, fst_offset, fst_size = struct.unpack_from('>III', header, 0x420)
+        if dol_offset == 0:
+            raise ValueError('no DOL offset (Datel disc), the IPL skips these')
+
+        f.seek(fst_offset)
+        fst = f.read(fst_size)
+
+    total = struct.unpack_from('>I', fst, 8)[0]
+    strings = total * FST_ENTRY_SIZE
+    for i in range(1, total):
+        word, addr, length = struct.unpack_from('>III', fst, i * FST_ENTRY_SIZE)
+        if word >> 24 != 0:
+            continue # directory
+
+        name_offset = strings + (word & 0xFFFFFF)
+        name = fst[name_offset:fst.index(b'\0', name_offset)]
+        if name.lower() == b'opening.bnr':
+            return zlib.crc32(header) & 0xFFFFFFFF, addr
+
+    raise ValueError('no opening.bnr in the FST')
+
+def read_table(path):
+    with open(path, 'r') as f:
+        text = f.read()
+
+    # the struct array this script replaced
+    pairs = re.findall(r'\{\s*(0x[0-9a-fA-F]+)\s*,\s*(0x[0-9a-fA-F]+)\s*\}', text)
+    if pairs:
+        return {int(h, 16): int(o, 16) for h, o in pairs}
+
+    def array(name):
+        body = re.search(name + r'\[\w*\]\s*=\s*\{(.*?)\};', text, re.S).group(1)
+        return [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', body)]
+
+    hashes = array('bnr_offset_hashes')
+    values = array('bnr_offset_values')
+    if len(hashes) != len(values):
+        raise ValueError(f'{path}: hash and value arrays differ in length')
+
+    return dict(zip(hashes, values))
+
+def format_words(words, per_line=8):
+    lines = []
+    for i in range(0, len(words), per_line):
+        lines.append('\t' + ' '.join(f'0x{w:08x},' for w in words[i:i + per_line]))
+    return '\n'.join(lines)
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the known banner offsets table')
+    parser.add_argument('dumps', nargs='*', help='.iso/.gcm disc dumps')
+    parser.add_argument('--list', help='file with one dump path per line')
+    parser.add_argument('--merge', help='existing bnr_offsets.c to keep entries from')
+    parser.add_argument('-o', '--output', help='output path, stdout when missing')
+    args = parser.parse_args()
+
+    table = read_table(args.merge) if args.merge else {}
+    merged = len(table)
+
+    dumps = list(args.dumps)
+    if args.list:
+        with open(args.list, 'r') as f:
+            dumps += [line.strip() for line in f if line.strip() and not line.startswith('#')]
+
+    added = 0
+    for path in dumps:
+        try:
+            crc, offset = read_banner_offset(path)
+        except (OSError, ValueError, struct.error) as e:
+            print(f'skipping {path}: {e}', file=sys.stderr)
+            continue
+
+        if crc in table and table[crc] != offset:
+            print(f'{path}: header {crc:08x} already maps to {table[crc]:08x}, keeping {offset:08x}', file=sys.stderr)
+        if crc not in table:
+            added += 1
+        table[crc] = offset
+
+    hashes = sorted(table)
+    output = output_template.format(
+        count=len(hashes),
+        hashes=format_words(hashes),
+        values=format_words([table[h] for h in hashes]),
+    )
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(output)
+    else:
+        sys.stdout.write(output)
+
+    print(f'{len(hashes)} entries ({merged} merged, {added} new)', file=sys.stderr)
+
+if __name__ == '__main__':
+    main()
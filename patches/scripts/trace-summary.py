@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+# Summarise a boot timeline written with `trace_dump = 1` (cubeboot-trace.json)
+# or captured from USB Gecko with `trace_dump = 2` (the log between TRACE BEGIN
+# and TRACE END). Optionally writes a clean Chrome trace for ui.perfetto.dev.
+
+import sys
+import json
+import argparse
+
+def load_trace(path):
+    with open(path, 'r', errors='replace') as f:
+        text = f.read()
+
+    if 'TRACE BEGIN' in text:
+        text = text.split('TRACE BEGIN', 1)[1].split('TRACE END', 1)[0]
+
+    return json.loads(text)
+
+def summarize(trace):
+    events = [e for e in trace['traceEvents'] if e['ph'] != 'M']
+    threads = {e['tid']: e['args']['name'] for e in trace['traceEvents'] if e['ph'] == 'M'}
+
+    spans = []
+    stacks = {}
+    for e in events:
+        stack = stacks.setdefault(e['tid'], [])
+        if e['ph'] == 'B':
+            stack.append(e)
+        elif e['ph'] == 'E':
+            # the ring may have dropped the matching begin
+            while stack and stack[-1]['name'] != e['name']:
+                stack.pop()
+            if stack:
+                begin = stack.pop()
+                spans.append((begin['ts'], e['ts'] - begin['ts'], len(stack), e))
+
+    total = max(e['ts'] for e in events) if events else 0
+    print(f'{len(events)} events, {total / 1000.0:.3f} ms from first record')
+    print()
+
+    for ts, dur, depth, e in sorted(spans, key=lambda s: (s[0], s[2])):
+        thread = threads.get(e['tid'], str(e['tid']))
+        name = '  ' * depth + e['name']
+        print(f'{ts / 1000.0:10.3f} ms  {dur / 1000.0:10.3f} ms  {name:<24} {thread:<16} arg={e["args"].get("arg", 0)}')
+
+    for e in events:
+        if e['ph'] in ('i', 'C'):
+            value = e['args'].get('arg', e['args'].get('value', 0))
+            print(f'{e["ts"] / 1000.0:10.3f} ms  {"mark":>13}  {e["name"]:<24} {threads.get(e["tid"], str(e["tid"])):<16} arg={value}')
+
+def main():
+    parser = argparse.ArgumentParser(description='Summarise a cubeboot boot trace')
+    parser.add_argument('input', help='cubeboot-trace.json or a USB Gecko log')
+    parser.add_argument('-o', '--output', help='write the extracted Chrome trace here')
+    args = parser.parse_args()
+
+    trace = load_trace(args.input)
+    summarize(trace)
+
+    if args.output:
+        with open(args.output, 'w') as output:
+            json.dump(trace, output)
+
+if __name__ == '__main__':
+    sys.exit(main())
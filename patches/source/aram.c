@@ -0,0 +1,227 @@
+#include <gctypes.h>
+
+#include "picolibc.h"
+#include "reloc.h"
+#include "attr.h"
+
+#include "aram.h"
+
+#define ARAM_FLAG_HEAD 0x1 // first block of a free or used range
+#define ARAM_FLAG_USED 0x2
+
+// per smallest block, only meaningful on heads
+static u8 aram_flags[ARAM_BLOCK_COUNT];
+static u8 aram_order[ARAM_BLOCK_COUNT];
+static u32 aram_owner[ARAM_BLOCK_COUNT];
+static bool aram_ready = false;
+
+static const struct {
+    u32 owner;
+    const char *name;
+} aram_owner_names[] = {
+    { ARAM_OWNER_IPL, "ipl" },
+    { ARAM_OWNER_STAGE, "ipl staging" },
+    { ARAM_OWNER_BANNER, "banner cache" },
+    { ARAM_OWNER_SWISS, "swiss preload" },
+    { ARAM_OWNER_DIRS, "directory cache" },
+    { ARAM_OWNER_CATALOG, "game catalog" },
+};
+
+// the callers run from different threads and at different times, set up on first use
+static void aram_init() {
+    if (aram_ready) return;
+    aram_ready = true;
+
+    memset(aram_flags, 0, sizeof(aram_flags));
+    aram_flags[0] = ARAM_FLAG_HEAD;
+    aram_order[0] = ARAM_MAX_ORDER;
+
+    aram_reserve(ARAM_OWNER_IPL, ARAM_IPL_BASE, ARAM_IPL_SIZE);
+    aram_reserve(ARAM_OWNER_STAGE, ARAM_STAGE_BASE, ARAM_STAGE_SIZE);
+    aram_reserve(ARAM_OWNER_BANNER, ARAM_PERSIST_BASE, ARAM_PERSIST_SIZE);
+}
+
+static u32 aram_size_order(u32 size) {
+    u32 order = 0;
+    while (order < ARAM_MAX_ORDER && (ARAM_BLOCK_SIZE << order) < size) order++;
+    return order;
+}
+
+// halves a free head until it is target_order, keeping the half holding keep
+static u32 aram_split(u32 block, u32 target_order, u32 keep) {
+    while (aram_order[block] > target_order) {
+        u32 order = --aram_order[block];
+        u32 buddy = block + (1 << order);
+
+        aram_flags[buddy] = ARAM_FLAG_HEAD;
+        aram_order[buddy] = order;
+        if (keep >= buddy) {
+            aram_flags[block] = ARAM_FLAG_HEAD;
+            block = buddy;
+        }
+    }
+
+    return block;
+}
+
+bool aram_reserve(u32 owner, u32 offset, u32 size) {
+    aram_init();
+
+    u32 order = aram_size_order(size);
+    u32 block = offset / ARAM_BLOCK_SIZE;
+    if (offset % ARAM_BLOCK_SIZE != 0 || (block & ((1 << order) - 1)) != 0)
+        return false;
+
+    BOOL enabled = OSDisableInterrupts();
+
+    // the free range that holds the target
+    for (u32 j = order; j <= ARAM_MAX_ORDER; j++) {
+        u32 head = block & ~((1 << j) - 1);
+        if ((aram_flags[head] & ARAM_FLAG_HEAD) == 0 || aram_order[head] != j) continue;
+
+        if (aram_flags[head] & ARAM_FLAG_USED) break;
+
+        head = aram_split(head, order, block);
+        aram_flags[head] = ARAM_FLAG_HEAD | ARAM_FLAG_USED;
+        aram_owner[head] = owner;
+
+        OSRestoreInterrupts(enabled);
+        return true;
+    }
+
+    OSRestoreInterrupts(enabled);
+    OSReport("ERROR: ARAM range %08x+%x is taken\n", offset, size);
+    return false;
+}
+
+u32 aram_alloc(u32 owner, u32 size) {
+    aram_init();
+    if (size == 0 || size > ARAM_SIZE) return ARAM_NONE;
+
+    u32 order = aram_size_order(size);
+    BOOL enabled = OSDisableInterrupts();
+
+    // best fit, the smallest free range that is large enough
+    u32 best = ARAM_BLOCK_COUNT;
+    for (u32 block = 0; block < ARAM_BLOCK_COUNT; block += 1 << aram_order[block]) {
+        if (aram_flags[block] & ARAM_FLAG_USED) continue;
+        if (aram_order[block] < order) continue;
+        if (best == ARAM_BLOCK_COUNT || aram_order[block] < aram_order[best]) best = block;
+        if (aram_order[best] == order) break;
+    }
+
+    if (best == ARAM_BLOCK_COUNT) {
+        OSRestoreInterrupts(enabled);
+        return ARAM_NONE;
+    }
+
+    best = aram_split(best, order, best);
+    aram_flags[best] = ARAM_FLAG_HEAD | ARAM_FLAG_USED;
+    aram_owner[best] = owner;
+
+    OSRestoreInterrupts(enabled);
+    return best * ARAM_BLOCK_SIZE;
+}
+
+void aram_free(u32 offset) {
+    if (!aram_ready || offset == ARAM_NONE) return;
+
+    u32 block = offset / ARAM_BLOCK_SIZE;
+    if (block >= ARAM_BLOCK_COUNT || (aram_flags[block] & ARAM_FLAG_USED) == 0) {
+        OSReport("ERROR: ARAM free of unused block %08x\n", offset);
+        return;
+    }
+
+    BOOL enabled = OSDisableInterrupts();
+    aram_flags[block] = ARAM_FLAG_HEAD;
+    aram_owner[block] = 0;
+
+    // merge with free buddies of the same size
+    while (aram_order[block] < ARAM_MAX_ORDER) {
+        u32 order = aram_order[block];
+        u32 buddy = block ^ (1 << order);
+        if (aram_flags[buddy] != ARAM_FLAG_HEAD || aram_order[buddy] != order) break;
+
+        u32 low = block < buddy ? block : buddy;
+        u32 high = block < buddy ? buddy : block;
+        aram_flags[high] = 0;
+        aram_order[low] = order + 1;
+        block = low;
+    }
+
+    OSRestoreInterrupts(enabled);
+}
+
+u32 aram_block_size(u32 offset) {
+    u32 block = offset / ARAM_BLOCK_SIZE;
+    if (!aram_ready || block >= ARAM_BLOCK_COUNT || (aram_flags[block] & ARAM_FLAG_USED) == 0)
+        return 0;
+
+    return ARAM_BLOCK_SIZE << aram_order[block];
+}
+
+// bytes a request of size really takes
+u32 aram_alloc_size(u32 size) {
+    return ARAM_BLOCK_SIZE << aram_size_order(size);
+}
+
+u32 aram_free_size() {
+    aram_init();
+
+    u32 free_total = 0;
+    BOOL enabled = OSDisableInterrupts();
+    for (u32 block = 0; block < ARAM_BLOCK_COUNT; block += 1 << aram_order[block]) {
+        if ((aram_flags[block] & ARAM_FLAG_USED) == 0) free_total += ARAM_BLOCK_SIZE << aram_order[block];
+    }
+    OSRestoreInterrupts(enabled);
+
+    return free_total;
+}
+
+static const char *aram_owner_name(u32 owner) {
+    for (int i = 0; i < countof(aram_owner_names); i++) {
+        if (aram_owner_names[i].owner == owner) return aram_owner_names[i].name;
+    }
+
+    return "other";
+}
+
+// Occupancy per owner, plus the largest free range
+void aram_report() {
+    aram_init();
+
+    u32 owners[16] = {0};
+    u32 used[16] = {0};
+    u32 blocks[16] = {0};
+    int owner_count = 0;
+    u32 free_total = 0;
+    u32 free_largest = 0;
+
+    BOOL enabled = OSDisableInterrupts();
+    for (u32 block = 0; block < ARAM_BLOCK_COUNT; block += 1 << aram_order[block]) {
+        u32 size = ARAM_BLOCK_SIZE << aram_order[block];
+        if ((aram_flags[block] & ARAM_FLAG_USED) == 0) {
+            free_total += size;
+            if (size > free_largest) free_largest = size;
+            continue;
+        }
+
+        int i = 0;
+        while (i < owner_count && owners[i] != aram_owner[block]) i++;
+        if (i == owner_count && owner_count < countof(owners)) owners[owner_count++] = aram_owner[block];
+        if (i < owner_count) {
+            used[i] += size;
+            blocks[i]++;
+        }
+    }
+    OSRestoreInterrupts(enabled);
+
+    OSReport("ARAM occupancy:\n");
+    for (int i = 0; i < owner_count; i++) {
+        u32 owner = owners[i];
+        OSReport("\t%c%c%c%c %-16s %8x (%u blocks)\n", owner >> 24, (owner >> 16) & 0xFF, (owner >> 8) & 0xFF, owner & 0xFF,
+            aram_owner_name(owner), used[i], blocks[i]);
+        (void)owner;
+    }
+    OSReport("\tfree %x, largest %x\n", free_total, free_largest);
+}
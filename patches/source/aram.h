@@ -0,0 +1,49 @@
+#pragma once
+
+#include <gctypes.h>
+
+#include "attr.h"
+
+// ARAM region manager for the IPL side.
+// The bottom of ARAM belongs to the IPL (audio heap and the ARQ area), the
+// rest is handed out as power of two blocks from a buddy allocator. Every
+// block carries the same owner tag that its ARQ requests use, so the
+// occupancy report lines up with the DMA logs.
+
+#define ARAM_SIZE (16 * 1024 * 1024)
+#define ARAM_BLOCK_SIZE (8 * 1024) // smallest block, fits one BNR
+#define ARAM_BLOCK_COUNT (ARAM_SIZE / ARAM_BLOCK_SIZE)
+#define ARAM_MAX_ORDER 11 // ARAM_BLOCK_SIZE << 11 is all of ARAM
+
+#define ARAM_IPL_BASE 0x000000
+#define ARAM_IPL_SIZE 0x400000
+
+// cubeboot stages the IPL image here on every boot (load_ipl), so nothing
+// placed in it lives through a soft reset
+#define ARAM_STAGE_BASE 0xE00000
+#define ARAM_STAGE_SIZE 0x200000
+
+// survives a soft reset, the banner cache keeps its slot table here
+#define ARAM_PERSIST_SIZE 0x10000
+#define ARAM_PERSIST_BASE ARAM_IPL_SIZE
+
+#define ARAM_NONE 0 // never handed out, the IPL owns offset 0
+
+#define ARAM_OWNER_IPL    make_type('I', 'P', 'L', 'A')
+#define ARAM_OWNER_STAGE  make_type('I', 'P', 'L', 'S')
+#define ARAM_OWNER_BANNER make_type('I', 'X', 'X', 'S')
+#define ARAM_OWNER_SWISS  make_type('S', 'W', 'S', 'S')
+#define ARAM_OWNER_DIRS   make_type('G', 'D', 'I', 'R')
+#define ARAM_OWNER_CATALOG make_type('G', 'C', 'A', 'T')
+
+// reserves a fixed range, offset must be aligned to its power of two size
+bool aram_reserve(u32 owner, u32 offset, u32 size);
+
+// returns the ARAM offset of a block of at least size bytes, ARAM_NONE when full
+u32 aram_alloc(u32 owner, u32 size);
+void aram_free(u32 offset);
+
+u32 aram_block_size(u32 offset);
+u32 aram_alloc_size(u32 size);
+u32 aram_free_size();
+void aram_report();
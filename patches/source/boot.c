@@ -8,6 +8,7 @@
 #include "video.h"
 
 #include "time.h"
+#include "trace.h"
 #include "picolibc.h"
 #include "boot.h"
 #include "dol.h"
@@ -26,7 +27,7 @@
 
 void load_stub() {
     custom_OSReport("Loading stub...\n");
-    dvd_custom_open_flash("/stub.bin", FILE_ENTRY_TYPE_FILE, 0);
+    dvd_custom_open_flash("/stub.bin", FILE_ENTRY_TYPE_FILE, IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK);
     file_status_t *file_status = dvd_custom_status();
     if (file_status == NULL || file_status->result != 0) {
         custom_OSReport("Failed to open stub\n");
@@ -44,33 +45,197 @@ void load_stub() {
     return;
 }
 
+typedef struct {
+    u32 address;
+    u32 offset;
+    u32 length;
+} dol_run_t;
+
+#define DOL_MAX_RUNS (MAXTEXTSECTION + MAXDATASECTION)
+#define DOL_BSS_SLICE 0x4000
+
+// BSS minus the ranges covered by sections, sections like .sdata usually sit inside it
+typedef struct {
+    u32 start;
+    u32 end;
+} dol_gap_t;
+
+static int dol_collect_runs(DOLHEADER *hdr, dol_run_t *runs) {
+    int count = 0;
+    for (int i = 0; i < MAXTEXTSECTION + MAXDATASECTION; i++) {
+        u32 address = i < MAXTEXTSECTION ? hdr->textAddress[i] : hdr->dataAddress[i - MAXTEXTSECTION];
+        u32 offset = i < MAXTEXTSECTION ? hdr->textOffset[i] : hdr->dataOffset[i - MAXTEXTSECTION];
+        u32 length = i < MAXTEXTSECTION ? hdr->textLength[i] : hdr->dataLength[i - MAXTEXTSECTION];
+        if (address == 0 || length == 0) continue;
+
+        // insert in file order
+        int pos = count++;
+        while (pos > 0 && runs[pos - 1].offset > offset) {
+            runs[pos] = runs[pos - 1];
+            pos--;
+        }
+        runs[pos] = (dol_run_t){address, offset, length};
+    }
+
+    // merge sections that are contiguous both in the file and in memory
+    int merged = 0;
+    for (int i = 0; i < count; i++) {
+        dol_run_t *prev = merged ? &runs[merged - 1] : NULL;
+        if (prev && prev->offset + prev->length == runs[i].offset && prev->address + prev->length == runs[i].address) {
+            prev->length += runs[i].length;
+        } else {
+            runs[merged++] = runs[i];
+        }
+    }
+
+    return merged;
+}
+
+static int dol_collect_gaps(DOLHEADER *hdr, dol_run_t *runs, int run_count, dol_gap_t *gaps) {
+    if (hdr->bssAddress == 0 || hdr->bssLength == 0) return 0;
+
+    int count = 1;
+    gaps[0] = (dol_gap_t){hdr->bssAddress, hdr->bssAddress + hdr->bssLength};
+
+    for (int i = 0; i < run_count; i++) {
+        u32 run_start = runs[i].address;
+        u32 run_end = runs[i].address + runs[i].length;
+
+        for (int j = 0; j < count; j++) {
+            dol_gap_t *gap = &gaps[j];
+            if (run_end <= gap->start || run_start >= gap->end) continue;
+
+            if (run_start > gap->start && run_end < gap->end) {
+                // split, there is always room as each run adds at most one gap
+                gaps[count++] = (dol_gap_t){run_end, gap->end};
+                gap->end = run_start;
+            } else if (run_start > gap->start) {
+                gap->end = run_start;
+            } else {
+                gap->start = run_end < gap->end ? run_end : gap->end;
+            }
+        }
+    }
+
+    return count;
+}
+
+// Zeroes the whole cache blocks of the gaps with dcbz, up to max_bytes per call. The partial
+// blocks at the edges may share a line with a section that is still being read so they are
+// left for dol_clear_gap_edges once every read has landed.
+static u32 dol_clear_gaps(dol_gap_t *gaps, int gap_count, u32 *cursor, int *gap_index, u32 max_bytes) {
+    u32 cleared = 0;
+    while (*gap_index < gap_count && cleared < max_bytes) {
+        dol_gap_t *gap = &gaps[*gap_index];
+        u32 start = OSRoundUp32B(gap->start);
+        u32 end = gap->end & ~31;
+        if (*cursor < start) *cursor = start;
+
+        if (*cursor >= end) {
+            (*gap_index)++;
+            *cursor = 0;
+            continue;
+        }
+
+        u32 len = end - *cursor;
+        if (len > max_bytes - cleared) len = max_bytes - cleared;
+        DCZeroRange((void*)*cursor, len);
+        *cursor += len;
+        cleared += len;
+    }
+
+    return cleared;
+}
+
+static void dol_clear_gap_edges(dol_gap_t *gaps, int gap_count) {
+    for (int i = 0; i < gap_count; i++) {
+        u32 start = OSRoundUp32B(gaps[i].start);
+        u32 end = gaps[i].end & ~31;
+        if (start >= end) {
+            memset((void*)gaps[i].start, 0, gaps[i].end - gaps[i].start);
+            continue;
+        }
+        memset((void*)gaps[i].start, 0, start - gaps[i].start);
+        memset((void*)end, 0, gaps[i].end - end);
+    }
+}
+
 __attribute__((aligned(32))) static DOLHEADER dol_hdr;
-static dol_info_t load_dol(uint64_t offset, uint8_t fd) {
+static dol_info_t load_dol(uint64_t offset, uint8_t fd, bool passthrough) {
+    u64 start_time = gettime();
+    trace_begin(TRACE_DOL_LOAD);
+    u64 read_ticks = 0;
+    u64 flush_ticks = 0;
+    u32 bss_cleared = 0;
+
     DOLHEADER *hdr = &dol_hdr;
     dvd_read(hdr, sizeof(DOLHEADER), offset, fd);
+    u64 header_time = gettime();
 
-    // Clear BSS
-    // TODO: check if this overlaps with IPL?
+    dol_run_t runs[DOL_MAX_RUNS];
+    int run_count = dol_collect_runs(hdr, runs);
+
+    dol_gap_t gaps[DOL_MAX_RUNS + 1];
+    int gap_count = dol_collect_gaps(hdr, runs, run_count, gaps);
     if (hdr->bssAddress && hdr->bssLength) {
         custom_OSReport("Clearing BSS %08x - %08x...\n", hdr->bssAddress, hdr->bssAddress + hdr->bssLength);
-        memset((void*)hdr->bssAddress, 0, hdr->bssLength);
     }
 
-    // Inspect text sections to see if what we found lies in here
-    for (int i = 0; i < MAXTEXTSECTION; i++) {
-        if (hdr->textAddress[i] && hdr->textLength[i]) {
-            dvd_read_data((void*)hdr->textAddress[i], hdr->textLength[i], offset + hdr->textOffset[i], fd);
+    u32 gap_cursor = 0;
+    int gap_index = 0;
+    for (int i = 0; i < run_count; i++) {
+        dol_run_t *run = &runs[i];
+        void *dst = (void*)run->address;
+        u64 run_offset = offset + run->offset;
+        u64 read_start = gettime();
+
+        // on disc the DI transfer runs in the background while BSS is zeroed
+        bool aligned = ((run->address | run->length) & 31) == 0 && (run_offset & 3) == 0;
+        bool overlapped = passthrough && aligned;
+
+        // the run is overwritten whole, drop its lines so the dcbz evictions
+        // below can't write stale data back over the DMA
+        if (overlapped) DCInvalidateRange(dst, run->length);
+
+        if (overlapped && normal_dvd_read_start(dst, run->length, run_offset, fd) == 0) {
+            while (normal_dvd_read_busy() && gap_index < gap_count) {
+                bss_cleared += dol_clear_gaps(gaps, gap_count, &gap_cursor, &gap_index, DOL_BSS_SLICE);
+            }
+            if (normal_dvd_read_wait(dst, run->length) != 0) {
+                custom_OSReport("DOL section read failed: %08x\n", run->address);
+            }
+        } else {
+            dvd_read_data(dst, run->length, run_offset, fd);
+            bss_cleared += dol_clear_gaps(gaps, gap_count, &gap_cursor, &gap_index, DOL_BSS_SLICE);
         }
+
+        u64 flush_start = gettime();
+        read_ticks += flush_start - read_start;
+
+        // the section is final, publish it now instead of at run()
+        DCFlushRange(dst, run->length);
+        ICInvalidateRange(dst, run->length);
+        flush_ticks += gettime() - flush_start;
     }
 
-    // Inspect data sections (shouldn't really need to unless someone was sneaky..)
-    for (int i = 0; i < MAXDATASECTION; i++) {
-        if (hdr->dataAddress[i] && hdr->dataLength[i]) {
-            dvd_read_data((void*)hdr->dataAddress[i], hdr->dataLength[i], offset + hdr->dataOffset[i], fd);
-        }
+    // whatever BSS is left, then the shared edges
+    u64 bss_start = gettime();
+    bss_cleared += dol_clear_gaps(gaps, gap_count, &gap_cursor, &gap_index, 0xFFFFFFFF);
+    dol_clear_gap_edges(gaps, gap_count);
+    if (hdr->bssAddress && hdr->bssLength) {
+        DCFlushRange((void*)hdr->bssAddress, hdr->bssLength);
     }
+    u64 end_time = gettime();
 
     custom_OSReport("Copy done...\n");
+    custom_OSReport("DOL load: header=%f read=%f flush=%f bss_tail=%f total=%f (runs=%d, bss overlapped=%u)\n",
+        (f32)diff_usec(start_time, header_time) / 1000.0,
+        (f32)ticks_to_microsecs(read_ticks) / 1000.0,
+        (f32)ticks_to_microsecs(flush_ticks) / 1000.0,
+        (f32)diff_usec(bss_start, end_time) / 1000.0,
+        (f32)diff_usec(start_time, end_time) / 1000.0,
+        run_count, bss_cleared);
+    trace_end(TRACE_DOL_LOAD, run_count);
 
     void *entrypoint = (void*)hdr->entryPoint;
     u32 dol_max = DOLMax(hdr);
@@ -81,7 +246,8 @@ static dol_info_t load_dol(uint64_t offset, uint8_t fd) {
 
 
 dol_info_t load_dol_file(char *path, bool flash) {
-    uint8_t flags = IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_DISABLESPEEDEMU;
+    // small sections are served from the read-ahead window
+    uint8_t flags = IPC_FILE_FLAG_DISABLESPEEDEMU;
     if (flash) {
         dvd_custom_open_flash(path, FILE_ENTRY_TYPE_FILE, flags);
     } else {
@@ -94,7 +260,7 @@ dol_info_t load_dol_file(char *path, bool flash) {
         return (dol_info_t){0, 0};
     }
 
-    dol_info_t info = load_dol(0, file_status->fd);
+    dol_info_t info = load_dol(0, file_status->fd, false);
     dvd_custom_close(file_status->fd);
 
     return info;
@@ -169,7 +335,7 @@ const int GXPokeARGBPatch_length = 0x18;
 
 extern const void _patches_end;
 
-void chainload_boot_game(gm_file_entry_t *boot_entry, bool passthrough) {
+void chainload_boot_game(gm_boot_entry_t *boot_entry, bool passthrough) {
     extern u32 force_swiss_boot;
     if (!passthrough || force_swiss_boot)
         chainload_swiss_game(boot_entry == NULL ? NULL : boot_entry->path, passthrough);
@@ -327,7 +493,7 @@ void chainload_boot_game(gm_file_entry_t *boot_entry, bool passthrough) {
         }
     }
 
-    dol_info_t info = load_dol(dol_offset, 0);
+    dol_info_t info = load_dol(dol_offset, 0, passthrough);
     custom_OSReport("Booting... (%08x)\n", (u32)info.entrypoint);
 
     char *game_code = (char*)&lowmem->b_disk_info.game_code[0];
@@ -378,6 +544,11 @@ void chainload_boot_game(gm_file_entry_t *boot_entry, bool passthrough) {
 }
 
 void run(register void* entry_point) {
+    // last chance to get the timeline out, lowmem may already hold the game
+    extern u32 trace_dump_target;
+    trace_end(TRACE_GAME_BOOT, (u32)entry_point);
+    trace_dump(trace_dump_target);
+
     // ICFlashInvalidate
     asm("mfhid0	4");
     asm("ori 4, 4, 0x0800");
@@ -12,7 +12,7 @@ typedef struct {
 void load_stub();
 dol_info_t load_dol_file(char *path, bool flash);
 
-void chainload_boot_game(gm_file_entry_t *boot_entry, bool passthrough);
+void chainload_boot_game(gm_boot_entry_t *boot_entry, bool passthrough);
 void chainload_swiss_game(char *game_path, bool passthrough);
 
 // from iso9660
@@ -0,0 +1,445 @@
+#include <gctypes.h>
+
+#include "picolibc.h"
+#include "reloc.h"
+#include "attr.h"
+
+#include "dolphin_os.h"
+#include "dolphin_arq.h"
+#include "flippy_sync.h"
+#include "dvd_threaded.h"
+#include "crc32.h"
+#include "time.h"
+#include "aram.h"
+
+#include "catalog.h"
+
+#define CATALOG_INDEX_SIZE 16384 // power of two, well above CATALOG_MAX_ENTRIES
+#define CATALOG_INDEX_EMPTY 0xFFFF
+
+// records move between SD and ARAM a chunk at a time, a page holds whole chunks
+#define CATALOG_CHUNK_RECORDS 32
+#define CATALOG_PAGE_SIZE (64 * 1024)
+#define CATALOG_PAGE_RECORDS (CATALOG_PAGE_SIZE / sizeof(catalog_entry_t) / CATALOG_CHUNK_RECORDS * CATALOG_CHUNK_RECORDS)
+#define CATALOG_MAX_PAGES ((CATALOG_MAX_ENTRIES + CATALOG_PAGE_RECORDS - 1) / CATALOG_PAGE_RECORDS)
+
+#define CATALOG_FLAG_SEEN 0x1 // touched this session
+
+_Static_assert(sizeof(catalog_entry_t) % 32 == 0); // ARAM DMA granularity
+_Static_assert(CATALOG_MAX_ENTRIES < CATALOG_INDEX_EMPTY);
+
+// what a lookup needs without going to ARAM
+typedef struct {
+    u32 path_hash;
+    u32 name_hash;
+    u32 file_size;
+    u32 file_mtime;
+} catalog_key_t;
+
+__attribute_data_lowmem__ static catalog_key_t catalog_keys[CATALOG_MAX_ENTRIES];
+__attribute_data_lowmem__ static u8 catalog_flags[CATALOG_MAX_ENTRIES];
+__attribute_data_lowmem__ static u16 catalog_index[CATALOG_INDEX_SIZE];
+
+__attribute_aligned_data_lowmem__ static catalog_entry_t catalog_chunk[CATALOG_CHUNK_RECORDS];
+__attribute_aligned_data_lowmem__ static catalog_entry_t catalog_record;
+__attribute_aligned_data_lowmem__ static catalog_header_t catalog_header;
+
+static u32 catalog_pages[CATALOG_MAX_PAGES];
+static u32 catalog_page_count = 0;
+static u32 catalog_count = 0;
+
+// the menu looks up descriptions while the enum thread fills the catalog
+static OSMutex catalog_mutex;
+
+static bool catalog_loaded = false;
+static bool catalog_ready = false;
+static bool catalog_dirty = false;
+static u32 catalog_evict_cursor = 0;
+static bool catalog_full_reported = false;
+
+typedef struct {
+    ARQRequest req; // first, the callback gets its address
+    volatile bool busy;
+} catalog_dma_t;
+
+static void catalog_dma_cb(u32 arq_request_ptr) {
+    ((catalog_dma_t*)arq_request_ptr)->busy = false;
+}
+
+// one request per buffer, the chunk is streamed while single records are looked up
+static catalog_dma_t catalog_dma_chunk;
+static catalog_dma_t catalog_dma_record;
+
+static void catalog_dma(catalog_dma_t *dma, u32 type, void *mram, u32 aram_offset, u32 length) {
+    u32 source = type == ARAM_DIR_MRAM_TO_ARAM ? (u32)mram : aram_offset;
+    u32 dest = type == ARAM_DIR_MRAM_TO_ARAM ? aram_offset : (u32)mram;
+
+    dma->busy = true;
+    if (type == ARAM_DIR_MRAM_TO_ARAM) {
+        DCFlushRange(mram, length);
+    } else {
+        DCInvalidateRange(mram, length);
+    }
+    dolphin_ARQPostRequest(&dma->req, ARAM_OWNER_CATALOG, type, ARQ_PRIORITY_LOW, source, dest, length, &catalog_dma_cb);
+    while (dma->busy)
+        OSYieldThread();
+}
+
+// the ARAM behind a record, its page is taken on first use, ARAM_NONE when ARAM is full
+static u32 catalog_aram_offset(u32 slot) {
+    u32 page = slot / CATALOG_PAGE_RECORDS;
+    while (catalog_page_count <= page) {
+        u32 offset = aram_alloc(ARAM_OWNER_CATALOG, CATALOG_PAGE_SIZE);
+        if (offset == ARAM_NONE) return ARAM_NONE;
+        catalog_pages[catalog_page_count++] = offset;
+    }
+
+    return catalog_pages[page] + (slot % CATALOG_PAGE_RECORDS) * sizeof(catalog_entry_t);
+}
+
+static u32 catalog_hash(const char *path) {
+    return tinf_crc32(path, strlen(path));
+}
+
+static u32 catalog_name_hash(const char *path) {
+    const char *name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+    return tinf_crc32(name, strlen(name));
+}
+
+static int catalog_find(u32 hash, u32 name_hash) {
+    u32 pos = hash & (CATALOG_INDEX_SIZE - 1);
+    for (int i = 0; i < CATALOG_INDEX_SIZE; i++) {
+        u16 slot = catalog_index[pos];
+        if (slot == CATALOG_INDEX_EMPTY)
+            return -1;
+
+        catalog_key_t *key = &catalog_keys[slot];
+        if (key->path_hash == hash && key->name_hash == name_hash)
+            return slot;
+
+        pos = (pos + 1) & (CATALOG_INDEX_SIZE - 1);
+    }
+
+    return -1;
+}
+
+static void catalog_index_insert(u32 hash, int slot) {
+    u32 pos = hash & (CATALOG_INDEX_SIZE - 1);
+    while (catalog_index[pos] != CATALOG_INDEX_EMPTY) {
+        pos = (pos + 1) & (CATALOG_INDEX_SIZE - 1);
+    }
+    catalog_index[pos] = slot;
+}
+
+static void catalog_index_rebuild() {
+    memset(catalog_index, 0xFF, sizeof(catalog_index));
+    for (int i = 0; i < catalog_count; i++) {
+        catalog_index_insert(catalog_keys[i].path_hash, i);
+    }
+}
+
+static void catalog_reset() {
+    catalog_count = 0;
+    memset(catalog_index, 0xFF, sizeof(catalog_index));
+}
+
+static void catalog_set_key(u32 slot, catalog_entry_t *entry) {
+    catalog_key_t *key = &catalog_keys[slot];
+    key->path_hash = entry->path_hash;
+    key->name_hash = entry->name_hash;
+    key->file_size = entry->extra.file_size;
+    key->file_mtime = entry->extra.file_mtime;
+    catalog_flags[slot] = 0;
+}
+
+static const char *catalog_paths[2] = { CATALOG_PATH, CATALOG_ALT_PATH };
+
+// opens a catalog file, -1 when it is not there
+static int catalog_open(const char *path, uint8_t flags, u32 *file_size) {
+    if (dvd_custom_open(path, FILE_ENTRY_TYPE_FILE, flags) != 0)
+        return -1;
+
+    file_status_t *status = dvd_custom_status();
+    if (status == NULL || status->result != 0) {
+        dvd_custom_close(status ? status->fd : 0);
+        return -1;
+    }
+
+    if (file_size != NULL) *file_size = (u32)__builtin_bswap64(*(u64*)(&status->fsize));
+    return status->fd;
+}
+
+static bool catalog_read_header(u32 fd, u32 file_size) {
+    catalog_header_t *header = &catalog_header;
+    if (file_size < sizeof(catalog_header_t))
+        return false;
+
+    if (dvd_threaded_read(header, sizeof(catalog_header_t), 0, fd) != 0)
+        return false;
+
+    if (header->magic != CATALOG_MAGIC || header->version != CATALOG_VERSION || header->entry_size != sizeof(catalog_entry_t))
+        return false;
+
+    return header->count <= CATALOG_MAX_ENTRIES && file_size >= sizeof(catalog_header_t) + header->count * sizeof(catalog_entry_t);
+}
+
+// the file with the newest valid header, -1 when neither is usable
+static int catalog_newest(u32 *generation) {
+    const uint8_t flags = IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_DISABLESPEEDEMU;
+
+    int newest = -1;
+    for (int i = 0; i < countof(catalog_paths); i++) {
+        u32 file_size;
+        int fd = catalog_open(catalog_paths[i], flags, &file_size);
+        if (fd < 0) continue;
+
+        bool valid = catalog_read_header(fd, file_size);
+        dvd_custom_close(fd);
+
+        if (valid && (newest < 0 || catalog_header.generation > *generation)) {
+            newest = i;
+            *generation = catalog_header.generation;
+        }
+    }
+
+    return newest;
+}
+
+// the records go through the chunk buffer into their ARAM pages
+static bool catalog_read(const char *path) {
+    const uint8_t flags = IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_DISABLESPEEDEMU;
+    u32 file_size;
+    int fd = catalog_open(path, flags, &file_size);
+    if (fd < 0)
+        return false;
+
+    catalog_header_t *header = &catalog_header;
+    bool ok = catalog_read_header(fd, file_size);
+
+    u32 crc = 0;
+    for (u32 start = 0; ok && start < header->count; start += CATALOG_CHUNK_RECORDS) {
+        u32 count = header->count - start < CATALOG_CHUNK_RECORDS ? header->count - start : CATALOG_CHUNK_RECORDS;
+        u32 len = count * sizeof(catalog_entry_t);
+        ok = dvd_threaded_read(catalog_chunk, len, sizeof(catalog_header_t) + start * sizeof(catalog_entry_t), fd) == 0;
+        if (!ok) break;
+        crc = tinf_crc32_update(crc, catalog_chunk, len);
+
+        u32 aram_offset = catalog_aram_offset(start);
+        if (aram_offset == ARAM_NONE) {
+            OSReport("WARNING: no ARAM for the catalog past %u entries\n", start);
+            ok = false;
+            break;
+        }
+        catalog_dma(&catalog_dma_chunk, ARAM_DIR_MRAM_TO_ARAM, catalog_chunk, aram_offset, len);
+
+        for (u32 i = 0; i < count; i++) {
+            catalog_set_key(start + i, &catalog_chunk[i]);
+        }
+    }
+    dvd_custom_close(fd);
+
+    if (ok && crc != header->crc) {
+        OSReport("Catalog checksum mismatch in %s\n", path);
+        ok = false;
+    }
+
+    if (ok) catalog_count = header->count;
+    return ok;
+}
+
+void catalog_load() {
+    if (catalog_loaded) return;
+    catalog_loaded = true;
+    OSInitMutex(&catalog_mutex);
+
+    u64 start_time = gettime();
+    catalog_reset();
+
+    // the newest file first, the other one when it does not read back
+    u32 generation = 0;
+    int newest = catalog_newest(&generation);
+    const char *source = "nothing";
+    for (int i = 0; newest >= 0 && i < countof(catalog_paths); i++) {
+        const char *path = catalog_paths[(newest + i) % countof(catalog_paths)];
+        if (catalog_read(path)) {
+            source = path;
+            break;
+        }
+        catalog_reset();
+    }
+
+    catalog_index_rebuild();
+    catalog_ready = true;
+
+    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
+    OSReport("Catalog load took=%f (%u entries from %s)\n", runtime, catalog_count, source);
+    (void)source;
+    (void)runtime;
+}
+
+// Writes the catalog into the older of the two files. Callers must not hold
+// the card mutex: the card has a single file handle, so the file is opened
+// again for every chunk of records and other card users get the card in
+// between. A cancel stops the save between chunks, the newest file stays
+// as it was and the catalog stays dirty.
+void catalog_save() {
+    if (!catalog_dirty || gm_enum_cancelled()) return;
+
+    u64 start_time = gettime();
+    gm_card_lock();
+
+    u32 generation = 0;
+    int newest = catalog_newest(&generation);
+    const char *path = catalog_paths[newest == 0 ? 1 : 0];
+
+    // this file is not the newest one, it can go invalid until the header is written
+    dvd_custom_mkdir(CATALOG_DIR);
+    int fd = catalog_open(path, IPC_FILE_FLAG_DISABLESPEEDEMU | IPC_FILE_FLAG_WRITE, NULL);
+    bool ok = fd >= 0;
+    if (ok) {
+        memset(&catalog_header, 0, sizeof(catalog_header_t));
+        ok = dvd_custom_write((char*)&catalog_header, 0, sizeof(catalog_header_t), fd) == 0;
+        dvd_custom_close(fd);
+    }
+    gm_card_unlock();
+
+    // updates that come in from here on are saved next time
+    catalog_dirty = false;
+    u32 total = catalog_count;
+
+    u32 crc = 0;
+    bool stopped = false;
+    for (u32 start = 0; ok && start < total; start += CATALOG_CHUNK_RECORDS) {
+        if (gm_enum_cancelled()) {
+            stopped = true;
+            break;
+        }
+
+        u32 count = total - start < CATALOG_CHUNK_RECORDS ? total - start : CATALOG_CHUNK_RECORDS;
+        u32 len = count * sizeof(catalog_entry_t);
+        catalog_dma(&catalog_dma_chunk, ARAM_DIR_ARAM_TO_MRAM, catalog_chunk, catalog_aram_offset(start), len);
+        crc = tinf_crc32_update(crc, catalog_chunk, len);
+
+        gm_card_lock();
+        fd = catalog_open(path, IPC_FILE_FLAG_DISABLESPEEDEMU | IPC_FILE_FLAG_WRITE, NULL);
+        ok = fd >= 0;
+        if (ok) {
+            ok = dvd_custom_write((char*)catalog_chunk, sizeof(catalog_header_t) + start * sizeof(catalog_entry_t), len, fd) == 0;
+            dvd_custom_close(fd);
+        }
+        gm_card_unlock();
+    }
+
+    // the header makes it the newest file
+    gm_card_lock();
+    stopped = stopped || gm_enum_cancelled();
+    if (ok && !stopped) {
+        fd = catalog_open(path, IPC_FILE_FLAG_DISABLESPEEDEMU | IPC_FILE_FLAG_WRITE, NULL);
+        ok = fd >= 0;
+        if (ok) {
+            catalog_header_t *header = &catalog_header;
+            memset(header, 0, sizeof(catalog_header_t));
+            header->magic = CATALOG_MAGIC;
+            header->version = CATALOG_VERSION;
+            header->entry_size = sizeof(catalog_entry_t);
+            header->count = total;
+            header->crc = crc;
+            header->generation = generation + 1;
+            ok = dvd_custom_write((char*)header, 0, sizeof(catalog_header_t), fd) == 0;
+            dvd_custom_close(fd);
+        }
+    }
+    gm_card_unlock();
+
+    if (!ok || stopped) catalog_dirty = true;
+    if (!ok) {
+        OSReport("ERROR: Failed to write %s\n", path);
+        return;
+    }
+    if (stopped) {
+        OSReport("Catalog save stopped, the previous one is kept\n");
+        return;
+    }
+
+    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
+    OSReport("Catalog save took=%f (%u entries)\n", runtime, total);
+    (void)runtime;
+}
+
+// True when path was probed before and has not changed since. The record is
+// only fetched from ARAM when entry is not NULL.
+bool catalog_lookup(const char *path, u32 file_size, u32 file_mtime, catalog_entry_t *entry) {
+    if (!catalog_ready) return false;
+
+    u32 hash = catalog_hash(path);
+    u32 name_hash = catalog_name_hash(path);
+
+    OSLockMutex(&catalog_mutex);
+    int slot = catalog_find(hash, name_hash);
+    if (slot < 0 || catalog_keys[slot].file_size != file_size || catalog_keys[slot].file_mtime != file_mtime) {
+        OSUnlockMutex(&catalog_mutex);
+        return false; // unknown, or changed on disk and probed again
+    }
+
+    catalog_flags[slot] |= CATALOG_FLAG_SEEN;
+    if (entry != NULL) {
+        catalog_dma(&catalog_dma_record, ARAM_DIR_ARAM_TO_MRAM, &catalog_record, catalog_aram_offset(slot), sizeof(catalog_entry_t));
+        memcpy(entry, &catalog_record, sizeof(catalog_entry_t));
+    }
+    OSUnlockMutex(&catalog_mutex);
+
+    return true;
+}
+
+// reuse a record that was not touched this session, -1 when all are live
+static int catalog_evict() {
+    for (int i = 0; i < catalog_count; i++) {
+        u32 slot = catalog_evict_cursor++ % catalog_count;
+        if ((catalog_flags[slot] & CATALOG_FLAG_SEEN) == 0)
+            return slot;
+    }
+
+    return -1;
+}
+
+void catalog_update(const char *path, gm_extra_t *extra, BNRDesc *desc) {
+    if (!catalog_ready) return;
+
+    u32 hash = catalog_hash(path);
+    u32 name_hash = catalog_name_hash(path);
+
+    OSLockMutex(&catalog_mutex);
+    int slot = catalog_find(hash, name_hash);
+
+    bool reindex = false;
+    if (slot < 0 && catalog_count < CATALOG_MAX_ENTRIES && catalog_aram_offset(catalog_count) != ARAM_NONE) {
+        slot = catalog_count++;
+        catalog_index_insert(hash, slot);
+    } else if (slot < 0) {
+        slot = catalog_evict();
+        if (slot < 0) {
+            if (!catalog_full_reported) {
+                OSReport("WARNING: catalog full, all %u entries were seen this session, %s and later games are not kept\n", catalog_count, path);
+                catalog_full_reported = true;
+            }
+            OSUnlockMutex(&catalog_mutex);
+            return;
+        }
+        reindex = true; // open addressing has no cheap delete
+    }
+
+    catalog_entry_t *entry = &catalog_record;
+    memset(entry, 0, sizeof(catalog_entry_t));
+    entry->path_hash = hash;
+    entry->name_hash = name_hash;
+    memcpy(&entry->extra, extra, sizeof(gm_extra_t));
+    memcpy(&entry->desc, desc, sizeof(BNRDesc));
+    catalog_dma(&catalog_dma_record, ARAM_DIR_MRAM_TO_ARAM, entry, catalog_aram_offset(slot), sizeof(catalog_entry_t));
+
+    catalog_set_key(slot, entry);
+    catalog_flags[slot] = CATALOG_FLAG_SEEN;
+    if (reindex) catalog_index_rebuild();
+    catalog_dirty = true;
+    OSUnlockMutex(&catalog_mutex);
+}
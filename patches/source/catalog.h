@@ -0,0 +1,46 @@
+#pragma once
+
+#include <gctypes.h>
+
+#include "bnr.h"
+#include "games.h"
+
+// Persistent game catalog, one record per probed image.
+// Records are revalidated against the size and mtime from the directory
+// listing, so only new or changed images are opened again.
+//
+// Only the lookup keys stay in lowmem. The records themselves live in ARAM
+// pages that are taken as the catalog grows, and are streamed to and from
+// SD through a small buffer. The two catalog files take turns, a save that
+// is stopped halfway leaves the newest one alone.
+
+#define CATALOG_DIR "/cubiboot"
+#define CATALOG_PATH "/cubiboot/catalog.bin"
+#define CATALOG_ALT_PATH "/cubiboot/catalog.alt"
+
+#define CATALOG_MAGIC 0x43434154 // 'CCAT'
+#define CATALOG_VERSION 2
+#define CATALOG_MAX_ENTRIES GM_MAX_ENTRIES
+
+typedef struct {
+    u32 path_hash; // crc32 of path
+    u32 name_hash; // crc32 of the file name, for paths whose path_hash collides
+    gm_extra_t extra;
+    BNRDesc desc;
+    u32 reserved[4];
+} catalog_entry_t;
+
+typedef struct {
+    u32 magic;
+    u16 version;
+    u16 entry_size;
+    u32 count;
+    u32 crc; // of the records
+    u32 generation; // the newer of the two files wins
+    u32 reserved[3];
+} catalog_header_t;
+
+void catalog_load();
+void catalog_save();
+bool catalog_lookup(const char *path, u32 file_size, u32 file_mtime, catalog_entry_t *entry);
+void catalog_update(const char *path, gm_extra_t *extra, BNRDesc *desc);
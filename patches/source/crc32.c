@@ -23,3 +23,18 @@ unsigned int tinf_crc32(const void *data, unsigned int length)
 
 	return crc ^ 0xFFFFFFFF;
 }
+
+unsigned int tinf_crc32_update(unsigned int crc, const void *data, unsigned int length)
+{
+	const unsigned char *buf = (const unsigned char *) data;
+	unsigned int i;
+
+	crc ^= 0xFFFFFFFF;
+	for (i = 0; i < length; ++i) {
+		crc ^= buf[i];
+		crc = tinf_crc32tab[crc & 0x0F] ^ (crc >> 4);
+		crc = tinf_crc32tab[crc & 0x0F] ^ (crc >> 4);
+	}
+
+	return crc ^ 0xFFFFFFFF;
+}
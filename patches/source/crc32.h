@@ -1 +1,4 @@
 unsigned int tinf_crc32(const void *data, unsigned int length);
+
+// running crc for data that arrives in pieces, start with crc = 0
+unsigned int tinf_crc32_update(unsigned int crc, const void *data, unsigned int length);
@@ -53,6 +53,9 @@ void ARClear(u32 flag);
 
 ////////////////////////////////////////////
 u16 __ARGetInterruptStatus();
+// polled transfers, usable with interrupts disabled
+void __ARWriteDMA(u32 mmem_addr, u32 aram_addr, u32 length);
+void __ARReadDMA(u32 mmem_addr, u32 aram_addr, u32 length);
 //////////////// AR DEFINES ////////////////
 // AR defines.
 #define AR_STACK_INDEX_ENTRY_SIZE sizeof(u32)
@@ -74,6 +77,8 @@ u16 __ARGetInterruptStatus();
 // ARQ defines.
 #define ARQ_DMA_ALIGNMENT      32
 #define ARQ_CHUNK_SIZE_DEFAULT 4096
+#define ARQ_CHUNK_SIZE_WHOLE   0x4000 // requests up to this size are not split
+#define ARQ_CHUNK_SIZE_MAX     0x10000
 
 #define ARQ_TYPE_MRAM_TO_ARAM ARAM_DIR_MRAM_TO_ARAM
 #define ARQ_TYPE_ARAM_TO_MRAM ARAM_DIR_ARAM_TO_MRAM
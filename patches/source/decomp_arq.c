@@ -1,6 +1,7 @@
 #include "decomp_ar.h"
 
 #include "reloc.h"
+#include "os.h"
 
 #define nullptr NULL
 
@@ -12,7 +13,7 @@ static ARQRequest* __ARQRequestPendingHi;
 static ARQRequest* __ARQRequestPendingLo;
 static ARQCallback __ARQCallbackHi;
 static ARQCallback __ARQCallbackLo;
-static u32 __ARQChunkSize;
+static u32 __ARQChunkSizeLo; // picked per request, see __ARQChunkFor
 
 static volatile BOOL __ARQ_init_flag = FALSE;
 
@@ -40,16 +41,36 @@ void __ARQPopTaskQueueHi()
 	}
 }
 
+// Small requests go in one DMA, large ones in pieces that grow with the
+// request, so a high priority request waits for at most one piece while a
+// long transfer does not pay one interrupt per 4KB.
+static u32 __ARQChunkFor(u32 length)
+{
+	if (length <= ARQ_CHUNK_SIZE_WHOLE) {
+		return length;
+	}
+
+	u32 chunk = OSRoundUp32B(length / 8);
+	if (chunk < ARQ_CHUNK_SIZE_WHOLE) {
+		chunk = ARQ_CHUNK_SIZE_WHOLE;
+	}
+	if (chunk > ARQ_CHUNK_SIZE_MAX) {
+		chunk = ARQ_CHUNK_SIZE_MAX;
+	}
+	return chunk;
+}
+
 void __ARQServiceQueueLo()
 {
 
 	if ((__ARQRequestPendingLo == nullptr) && (__ARQRequestQueueLo)) {
 		__ARQRequestPendingLo = __ARQRequestQueueLo;
 		__ARQRequestQueueLo   = __ARQRequestQueueLo->next;
+		__ARQChunkSizeLo      = __ARQChunkFor(__ARQRequestPendingLo->length);
 	}
 
 	if (__ARQRequestPendingLo) {
-		if (__ARQRequestPendingLo->length <= __ARQChunkSize) {
+		if (__ARQRequestPendingLo->length <= __ARQChunkSizeLo) {
 
 			if (__ARQRequestPendingLo->type == ARQ_TYPE_MRAM_TO_ARAM) {
 				ARStartDMA(__ARQRequestPendingLo->type, __ARQRequestPendingLo->source, __ARQRequestPendingLo->dest,
@@ -62,15 +83,15 @@ void __ARQServiceQueueLo()
 			__ARQCallbackLo = __ARQRequestPendingLo->callback;
 
 		} else if (__ARQRequestPendingLo->type == ARQ_TYPE_MRAM_TO_ARAM) {
-			ARStartDMA(__ARQRequestPendingLo->type, __ARQRequestPendingLo->source, __ARQRequestPendingLo->dest, __ARQChunkSize);
+			ARStartDMA(__ARQRequestPendingLo->type, __ARQRequestPendingLo->source, __ARQRequestPendingLo->dest, __ARQChunkSizeLo);
 
 		} else {
-			ARStartDMA(__ARQRequestPendingLo->type, __ARQRequestPendingLo->dest, __ARQRequestPendingLo->source, __ARQChunkSize);
+			ARStartDMA(__ARQRequestPendingLo->type, __ARQRequestPendingLo->dest, __ARQRequestPendingLo->source, __ARQChunkSizeLo);
 		}
 
-		__ARQRequestPendingLo->length -= __ARQChunkSize;
-		__ARQRequestPendingLo->source += __ARQChunkSize;
-		__ARQRequestPendingLo->dest += __ARQChunkSize;
+		__ARQRequestPendingLo->length -= __ARQChunkSizeLo;
+		__ARQRequestPendingLo->source += __ARQChunkSizeLo;
+		__ARQRequestPendingLo->dest += __ARQChunkSizeLo;
 	}
 }
 
@@ -105,7 +126,7 @@ void ARQInit()
 	OSReport("ARQInit\n");
 
 	__ARQRequestQueueHi = __ARQRequestQueueLo = nullptr;
-	__ARQChunkSize                            = ARQ_CHUNK_SIZE_DEFAULT;
+	__ARQChunkSizeLo                          = ARQ_CHUNK_SIZE_DEFAULT;
 	ARRegisterDMACallback(&__ARQInterruptServiceRoutine);
 	__ARQRequestPendingHi = nullptr;
 	__ARQRequestPendingLo = nullptr;
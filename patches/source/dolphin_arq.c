@@ -1,5 +1,6 @@
 #include "dolphin_arq.h"
 #include "dolphin_os.h"
+#include "os.h"
 
 #include "reloc.h"
 #include "attr.h"
@@ -43,3 +44,99 @@ void dolphin_ARQPostRequest(ARQRequest *task, u32 owner, u32 type, u32 priority,
 
     return;
 }
+
+void arq_batch_init(arq_batch_t *batch, u32 owner, u32 priority) {
+    batch->owner = owner;
+    batch->priority = priority;
+    batch->count = 0;
+    batch->next = 0;
+    batch->requests = 0;
+    batch->callback = NULL;
+    batch->busy = false;
+}
+
+bool arq_batch_add(arq_batch_t *batch, u32 type, void *mram, u32 aram, u32 length, void *tag) {
+    if (batch->count == ARQ_BATCH_MAX) return false;
+
+    arq_transfer_t *transfer = &batch->transfers[batch->count++];
+    transfer->type = type;
+    transfer->mram = (u32)mram;
+    transfer->aram = aram;
+    transfer->length = length;
+    transfer->tag = tag;
+    return true;
+}
+
+static bool arq_batch_adjacent(arq_transfer_t *a, arq_transfer_t *b) {
+    return a->type == b->type && a->aram + a->length == b->aram && a->mram + a->length == b->mram;
+}
+
+// posts the run of adjacent transfers starting at batch->next
+static void arq_batch_post_next(arq_batch_t *batch);
+
+static void arq_batch_request_done(u32 arq_request_ptr) {
+    arq_batch_t *batch = (arq_batch_t*)arq_request_ptr;
+    if (batch->next < batch->count) {
+        arq_batch_post_next(batch);
+        return;
+    }
+
+    batch->busy = false;
+    if (batch->callback) batch->callback(batch);
+}
+
+static void arq_batch_post_next(arq_batch_t *batch) {
+    u32 first = batch->next;
+    u32 length = batch->transfers[first].length;
+
+    u32 last = first;
+    while (last + 1 < batch->count && arq_batch_adjacent(&batch->transfers[last], &batch->transfers[last + 1])) {
+        length += batch->transfers[++last].length;
+    }
+    batch->next = last + 1;
+    batch->requests++;
+
+    arq_transfer_t *transfer = &batch->transfers[first];
+    u32 source = transfer->type == ARAM_DIR_MRAM_TO_ARAM ? transfer->mram : transfer->aram;
+    u32 dest = transfer->type == ARAM_DIR_MRAM_TO_ARAM ? transfer->aram : transfer->mram;
+    dolphin_ARQPostRequest(&batch->req, batch->owner, transfer->type, batch->priority, source, dest, length, &arq_batch_request_done);
+}
+
+void arq_batch_submit(arq_batch_t *batch, arq_batch_callback_t callback) {
+    batch->callback = callback;
+    batch->next = 0;
+    batch->requests = 0;
+    if (batch->count == 0) {
+        if (callback) callback(batch);
+        return;
+    }
+
+    // by direction then ARAM offset, few enough for an insertion sort
+    for (u32 i = 1; i < batch->count; i++) {
+        arq_transfer_t transfer = batch->transfers[i];
+        u32 j = i;
+        while (j > 0 && (batch->transfers[j - 1].type > transfer.type ||
+               (batch->transfers[j - 1].type == transfer.type && batch->transfers[j - 1].aram > transfer.aram))) {
+            batch->transfers[j] = batch->transfers[j - 1];
+            j--;
+        }
+        batch->transfers[j] = transfer;
+    }
+
+    for (u32 i = 0; i < batch->count; i++) {
+        arq_transfer_t *transfer = &batch->transfers[i];
+        if (transfer->type == ARAM_DIR_MRAM_TO_ARAM) {
+            DCFlushRange((void*)transfer->mram, transfer->length);
+        } else {
+            DCInvalidateRange((void*)transfer->mram, transfer->length);
+        }
+    }
+
+    batch->busy = true;
+    arq_batch_post_next(batch);
+}
+
+void arq_batch_wait(arq_batch_t *batch) {
+    while (batch->busy)
+        OSYieldThread();
+}
@@ -3,3 +3,38 @@
 
 void dolphin_ARAMInit();
 void dolphin_ARQPostRequest(ARQRequest *task, u32 owner, u32 type, u32 priority, u32 source, u32 dest, u32 length, ARQCallback callback);
+
+// Batched transfers
+// A list of moves with a single completion. The moves are sorted by ARAM
+// offset and neighbours that are contiguous on both sides go out as one
+// request, the next request is posted from the completion of the last so
+// the whole batch runs without waking the caller.
+#define ARQ_BATCH_MAX 32
+
+typedef struct arq_batch arq_batch_t;
+typedef void (*arq_batch_callback_t)(arq_batch_t *batch);
+
+typedef struct {
+    u32 type;
+    u32 mram;
+    u32 aram;
+    u32 length;
+    void *tag; // for the caller, to find its objects again on completion
+} arq_transfer_t;
+
+struct arq_batch {
+    ARQRequest req; // first, the ARQ callback gets its address
+    u32 owner;
+    u32 priority;
+    arq_transfer_t transfers[ARQ_BATCH_MAX];
+    u32 count;
+    u32 next; // first transfer not posted yet
+    u32 requests; // requests after merging, for the logs
+    arq_batch_callback_t callback;
+    volatile bool busy;
+};
+
+void arq_batch_init(arq_batch_t *batch, u32 owner, u32 priority);
+bool arq_batch_add(arq_batch_t *batch, u32 type, void *mram, u32 aram, u32 length, void *tag); // false when full
+void arq_batch_submit(arq_batch_t *batch, arq_batch_callback_t callback);
+void arq_batch_wait(arq_batch_t *batch);
@@ -23,32 +23,65 @@
 
 #define GET_OFFSET(o) ((u32)((o[0] << 16) | (o[1] << 8) | o[2]))
 
-#define ENTRY_IS_DIR(i) (entry_table[i].filetype == T_DIR)
-#define FILE_POSITION(i) (entry_table[i].addr)
-#define FILE_LENGTH(i) (entry_table[i].len)
+#define FST_CHUNK_SIZE 0x800
+#define BNR_NAME "opening.bnr"
 
 typedef struct {
     u32 offset;
     u32 length;
 } bnr_info_t;
 
+// A chunk of the FST, reloaded whenever a lookup falls outside of it
+typedef struct {
+    u32 fd;
+    u32 base; // FST offset on the disc
+    u32 size;
+    u32 start; // disc offset of buf
+    u32 len; // 0 until the first read
+    u8 *buf;
+} fst_window_t;
+
+// makes [pos, pos + len) of the FST readable, NULL when it is past the FST or the read failed
+static void *fst_window_at(fst_window_t *win, u32 pos, u32 len) {
+    if (pos + len > win->size) return NULL;
+
+    u32 offset = win->base + pos;
+    if (win->len == 0 || offset < win->start || offset + len > win->start + win->len) {
+        win->start = offset & ~31;
+        win->len = OSRoundUp32B(win->base + win->size) - win->start;
+        if (win->len > FST_CHUNK_SIZE) win->len = FST_CHUNK_SIZE;
+
+        if (dvd_threaded_read(win->buf, win->len, win->start, win->fd) != 0) {
+            win->len = 0;
+            return NULL;
+        }
+    }
+
+    return win->buf + (offset - win->start);
+}
+
+// Walks the root directory of the FST a chunk at a time, the banner is almost always one of
+// the first root entries so most discs only need one read. Subdirectories are skipped whole,
+// the IPL only ever opens the root opening.bnr.
 static bnr_info_t get_banner_offset_slow(DiskHeader *header, uint32_t fd) {
-    u32 size = OSRoundUp32B(header->FSTSize);
-    u32 offset = header->FSTOffset;
-    u8 *fst = (void*)0x81700000;
-
-    // read FST
-    dvd_threaded_read(fst, size, offset, fd);
-
-    FSTEntry *entry_table = (FSTEntry*)fst;
-    u32 total_entries = entry_table[0].len;
-    char *string_table = (char*)&(entry_table[total_entries]);
-    if ((u32)string_table < 0x81700000 || (u32)string_table > 0x81800000) {
-        OSReport("ERROR: String table is out of bounds: %08x\n", (u32)string_table);
-        return (bnr_info_t) {
-            .offset = 0,
-            .length = 0,
-        };
+    __attribute__((aligned(32))) static u8 entry_buf[FST_CHUNK_SIZE];
+    __attribute__((aligned(32))) static u8 name_buf[FST_CHUNK_SIZE];
+
+    // entries and names are far apart, each gets its own window
+    fst_window_t entries = { .fd = fd, .base = header->FSTOffset, .size = header->FSTSize, .buf = entry_buf };
+    fst_window_t names = entries;
+    names.buf = name_buf;
+
+    bnr_info_t info = { .offset = 0, .length = 0 };
+
+    FSTEntry *root = fst_window_at(&entries, 0, sizeof(FSTEntry));
+    if (root == NULL) return info;
+
+    u32 total_entries = root->len;
+    u32 string_table = total_entries * sizeof(FSTEntry);
+    if (total_entries == 0 || string_table > header->FSTSize) {
+        OSReport("ERROR: String table is out of bounds: %08x\n", string_table);
+        return info;
     }
 
 #ifdef PRINT_READDIR_FILES
@@ -56,37 +89,63 @@ static bnr_info_t get_banner_offset_slow(DiskHeader *header, uint32_t fd) {
     OSYieldThread();
 #endif
 
-    FSTEntry* p = entry_table;
-    for (u32 i = 1; i < total_entries; ++i) { //Start @ 1 to skip FST header
-        u32 string_offset = GET_OFFSET(p[i].offset);
-        char *string = (char*)((u32)string_table + string_offset);
-        // OSReport("String table = %08x, String offset = %08x\n", (u32)string_table, string_offset);
-        // OSReport("FST (0x%08x) entry: %s\n", FILE_POSITION(i), string);
-        if (entry_table[i].filetype == T_FILE && strcasecmp(string, "opening.bnr") == 0) {
+    for (u32 i = 1; i < total_entries;) { //Start @ 1 to skip FST header
+        FSTEntry *entry = fst_window_at(&entries, i * sizeof(FSTEntry), sizeof(FSTEntry));
+        if (entry == NULL) break;
+
+        // a directory holds everything up to its len
+        if (entry->filetype == T_DIR) {
+            if (entry->len <= i) break;
+            i = entry->len;
+            continue;
+        }
+
+        char *string = fst_window_at(&names, string_table + GET_OFFSET(entry->offset), sizeof(BNR_NAME));
+        if (string != NULL && string[sizeof(BNR_NAME) - 1] == '\0' && strcasecmp(string, BNR_NAME) == 0) {
 #ifdef PRINT_READDIR_FILES
-            OSReport("FST (0x%08x) entry: %s\n", FILE_POSITION(i), string);
+            OSReport("FST (0x%08x) entry: %s\n", entry->addr, string);
 #endif
 
-            OSYieldThread(); // allow rescheduling
-            return (bnr_info_t) {
-                .offset = FILE_POSITION(i),
-                .length = FILE_LENGTH(i),
-            };
+            info.offset = entry->addr;
+            info.length = entry->len;
+            break;
         }
+
+        i++;
     }
 
     OSYieldThread(); // allow rescheduling
-    return (bnr_info_t) {
-        .offset = 0,
-        .length = 0,
-    };
+    return info;
+}
+
+// Resolve a header that was already read (by the prefetching readdir) against the known offsets table,
+// the crc covers the whole header so a hit needs no banner magic check. The banner type is left
+// as single language until the banner itself is read.
+dolphin_game_into_t get_game_info_fast(DiskHeader *header) {
+    u32 fast_bnr_offset = get_banner_offset_fast(header);
+    if (fast_bnr_offset == 0) {
+        return (dolphin_game_into_t) { .valid = false };
+    }
+
+    dolphin_game_into_t info;
+    info.valid = true;
+    info.bnr_type = BANNER_SINGLE_LANG;
+    info.bnr_offset = fast_bnr_offset;
+    memcpy(info.game_id, header, 6);
+    info.disc_num = header->DiscID;
+    info.disc_ver = header->Version;
+    info.dol_offset = header->DOLOffset;
+    info.fst_offset = header->FSTOffset;
+    info.fst_size = header->FSTSize;
+    info.max_fst_size = header->MaxFSTSize;
+    return info;
 }
 
 // Get the BNR offset on the disc
 dolphin_game_into_t get_game_info(char *game_path) {
     __attribute__((aligned(32))) static u32 small_buf[8]; // for BNR reads
 
-    const uint8_t flags = IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLESPEEDEMU;
+    const uint8_t flags = IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_DISABLESPEEDEMU;
     int ret = dvd_custom_open(game_path, FILE_ENTRY_TYPE_FILE, flags);
     if (ret != 0) {
         OSReport("ERROR: Failed to open %s\n", game_path);
@@ -136,12 +195,6 @@ dolphin_game_into_t get_game_info(char *game_path) {
 
     // OSReport("DEBUG: loading FST from disk\n");
 
-    if (header.FSTSize > 0x100000) {
-        OSReport("ERROR: FST size is too large: %08x\n", header.FSTSize);
-        dvd_custom_close(status->fd);
-        return (dolphin_game_into_t) { .valid = false };
-    }
-
     // If we didn't find the banner in the fast location, try the FST
     bnr_info_t bnr_info = get_banner_offset_slow(&header, status->fd);
     if (bnr_info.offset != 0) {
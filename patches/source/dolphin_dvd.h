@@ -123,5 +123,6 @@ typedef struct {
 _Static_assert(sizeof(dolphin_game_into_t) == 32);
 
 dolphin_game_into_t get_game_info(char *game_path);
+dolphin_game_into_t get_game_info_fast(DiskHeader *header);
 
 #endif
@@ -35,6 +35,10 @@ void dolphin_OSWakeupThread(OSThreadQueue* queue) {
     OSWakeupThread(queue);   
 }
 
+void dolphin_OSSleepThread(OSThreadQueue* queue) {
+    OSSleepThread(queue);
+}
+
 // from https://github.com/zeldaret/tp/blob/a61e3491f7c46b698514af50464cf71ba76bd3a3/libs/dolphin/os/OSThread.c#L196
 OSThread* OSGetCurrentThread(void) {
     return __OSCurrentThread;
@@ -164,10 +164,14 @@ extern OSThread* __OSCurrentThread;
 extern OSThreadQueue __OSActiveThreadQueue;
 
 void OSYieldThread();
+OSThread* OSGetCurrentThread(void);
 BOOL OSJoinThread(OSThread *thread, void * val);
 void __OSPromoteThread(OSThread *thread, s32 priority);
 BOOL dolphin_OSCreateThread(OSThread *thread, OSThreadStartFunction func, void* param, void* stack, u32 stackSize, s32 priority, u16 attr);
 s32 dolphin_OSResumeThread(OSThread *thread);
+void dolphin_OSSleepThread(OSThreadQueue* queue);
+void dolphin_OSWakeupThread(OSThreadQueue* queue);
+void OSInitThreadQueue(OSThreadQueue* queue);
 
 void OSInitMutex(OSMutex* mutex);
 void OSLockMutex(OSMutex* mutex);
@@ -145,7 +145,7 @@ void dvd_audio_config(char use_streaming, char size) {
     return 0;
 }*/
 
-int normal_dvd_read(void* dst, unsigned int len, uint64_t offset, unsigned int fd) {
+int normal_dvd_read_start(void* dst, unsigned int len, uint64_t offset, unsigned int fd) {
 
     if (offset >> 2 > 0xFFFFFFFF) return -1;
 
@@ -166,6 +166,14 @@ int normal_dvd_read(void* dst, unsigned int len, uint64_t offset, unsigned int f
     _di_regs[DI_LENGTH] = len;
     _di_regs[DI_CR] = (DI_CR_DMA | DI_CR_TSTART); // start transfer
 
+    return 0;
+}
+
+bool normal_dvd_read_busy() {
+    return (_di_regs[DI_CR] & DI_CR_TSTART) != 0;
+}
+
+int normal_dvd_read_wait(void* dst, unsigned int len) {
     while (_di_regs[DI_CR] & DI_CR_TSTART); // transfer complete register
 
     DCInvalidateRange(dst, len);
@@ -177,6 +185,13 @@ int normal_dvd_read(void* dst, unsigned int len, uint64_t offset, unsigned int f
     return 0;
 }
 
+int normal_dvd_read(void* dst, unsigned int len, uint64_t offset, unsigned int fd) {
+    int ret = normal_dvd_read_start(dst, len, offset, fd);
+    if (ret != 0) return ret;
+
+    return normal_dvd_read_wait(dst, len);
+}
+
 int dvd_read_data(void* dst, unsigned int len, uint64_t offset, unsigned int fd) {
     uint64_t current_offset = offset;
     unsigned int total_read = 0;
@@ -46,11 +46,18 @@ void dvd_set_default_fd(uint32_t current_fd, uint32_t second_fd);
 int dvd_custom_write(char *buf, uint32_t offset, uint32_t length, uint32_t fd);
 int dvd_read(void* dst, unsigned int len, uint64_t offset, unsigned int fd);
 int dvd_read_data(void* dst, unsigned int len, uint64_t offset, unsigned int fd);
+// split DI read for overlapping work with the transfer (passthrough only)
+int normal_dvd_read(void* dst, unsigned int len, uint64_t offset, unsigned int fd);
+int normal_dvd_read_start(void* dst, unsigned int len, uint64_t offset, unsigned int fd);
+bool normal_dvd_read_busy();
+int normal_dvd_read_wait(void* dst, unsigned int len);
 file_status_t *dvd_custom_status();
 int dvd_custom_status_flash(file_status_t *dst);
 int dvd_custom_readdir(file_entry_t *dst, uint32_t fd);
+int dvd_custom_readdir_header(file_entry_t *dst, void *header, uint32_t header_len, uint32_t *header_read, uint32_t fd);
 int dvd_custom_unlink(char *path);
 int dvd_custom_unlink_flash(char *path);
+int dvd_custom_mkdir(char *path);
 int dvd_custom_open(const char *path, uint8_t type, uint8_t flags);
 int dvd_custom_open_flash(const char *path, uint8_t type, uint8_t flags);
 void dvd_custom_bypass_enter();
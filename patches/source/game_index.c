@@ -0,0 +1,86 @@
+#include <gctypes.h>
+
+#include "picolibc.h"
+
+#include "game_index.h"
+
+// fnv-1a over the 7 key bytes
+static u32 game_index_hash(const u8 game_id[6], u8 disc_num) {
+    u32 hash = 0x811C9DC5;
+    for (int i = 0; i < 6; i++) {
+        hash = (hash ^ game_id[i]) * 0x01000193;
+    }
+    hash = (hash ^ disc_num) * 0x01000193;
+    return hash;
+}
+
+static inline bool game_index_match(game_index_slot_t *slot, const u8 game_id[6], u8 disc_num) {
+    return slot->disc_num == disc_num && memcmp(slot->game_id, game_id, 6) == 0;
+}
+
+// slot holding the key, or the empty slot where it would go
+static u32 game_index_find(game_index_t *index, const u8 game_id[6], u8 disc_num) {
+    u32 pos = game_index_hash(game_id, disc_num) & index->mask;
+    while (index->slots[pos].used && !game_index_match(&index->slots[pos], game_id, disc_num)) {
+        pos = (pos + 1) & index->mask;
+    }
+    return pos;
+}
+
+void game_index_init(game_index_t *index, game_index_slot_t *slots, u32 size) {
+    index->slots = slots;
+    index->mask = size - 1;
+    game_index_clear(index);
+}
+
+void game_index_clear(game_index_t *index) {
+    memset(index->slots, 0, (index->mask + 1) * sizeof(game_index_slot_t));
+    index->count = 0;
+}
+
+bool game_index_get(game_index_t *index, const u8 game_id[6], u8 disc_num, u32 *value) {
+    game_index_slot_t *slot = &index->slots[game_index_find(index, game_id, disc_num)];
+    if (!slot->used) return false;
+
+    *value = slot->value;
+    return true;
+}
+
+bool game_index_put(game_index_t *index, const u8 game_id[6], u8 disc_num, u32 value) {
+    game_index_slot_t *slot = &index->slots[game_index_find(index, game_id, disc_num)];
+    if (!slot->used) {
+        // keep one slot free so probing always terminates
+        if (index->count + 1 > index->mask) return false;
+
+        memcpy(slot->game_id, game_id, 6);
+        slot->disc_num = disc_num;
+        slot->used = 1;
+        index->count++;
+    }
+
+    slot->value = value;
+    return true;
+}
+
+void game_index_remove(game_index_t *index, const u8 game_id[6], u8 disc_num) {
+    u32 hole = game_index_find(index, game_id, disc_num);
+    if (!index->slots[hole].used) return;
+
+    // pull later members of the probe run back into the hole
+    u32 pos = hole;
+    while (1) {
+        pos = (pos + 1) & index->mask;
+        game_index_slot_t *slot = &index->slots[pos];
+        if (!slot->used) break;
+
+        u32 home = game_index_hash(slot->game_id, slot->disc_num) & index->mask;
+        bool movable = hole <= pos ? (home <= hole || home > pos) : (home <= hole && home > pos);
+        if (movable) {
+            index->slots[hole] = *slot;
+            hole = pos;
+        }
+    }
+
+    index->slots[hole].used = 0;
+    index->count--;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <gctypes.h>
+
+// Open addressing index keyed on game id + disc number.
+// Keys are kept in the slots, so owners only store a value (an array index
+// or an offset). Linear probing with backward shift delete, no tombstones.
+
+typedef struct {
+    u8 game_id[6];
+    u8 disc_num;
+    u8 used;
+    u32 value;
+} game_index_slot_t;
+
+typedef struct {
+    game_index_slot_t *slots;
+    u32 mask; // size - 1, size must be a power of two
+    u32 count;
+} game_index_t;
+
+void game_index_init(game_index_t *index, game_index_slot_t *slots, u32 size);
+void game_index_clear(game_index_t *index);
+bool game_index_get(game_index_t *index, const u8 game_id[6], u8 disc_num, u32 *value);
+bool game_index_put(game_index_t *index, const u8 game_id[6], u8 disc_num, u32 value);
+void game_index_remove(game_index_t *index, const u8 game_id[6], u8 disc_num);
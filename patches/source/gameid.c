@@ -48,8 +48,11 @@ BOOL pre_custom_card_OSSendMessage(OSMessageQueue* mq, OSMessage msg, s32 flags)
         };
         DCFlushRange(&diskID, sizeof(diskID));
 
+        BNRDesc desc;
+        gm_entry_desc(mcp_selected_entry, &desc);
+
         char diskInfo[64];
-        strcpy(&diskInfo[0], mcp_selected_entry->desc.gameName);
+        strcpy(&diskInfo[0], desc.gameName);
         DCFlushRange(diskInfo, 64);
 
         setup_gameid_commands(&diskID, diskInfo);
@@ -15,7 +15,6 @@
 
 #include <gctypes.h>
 
-#include "pmalloc/pmalloc.h"
 #include "picolibc.h"
 #include "reloc.h"
 #include "attr.h"
@@ -32,6 +31,11 @@
 #include "grid.h"
 #include "menu.h"
 #include "time.h"
+#include "trace.h"
+#include "catalog.h"
+#include "game_index.h"
+#include "crc32.h"
+#include "aram.h"
 
 #include "emu/tweaks.h"
 
@@ -45,179 +49,338 @@
 int number_of_lines = 4;
 int game_backing_count = 0;
 
-static OSMutex game_enum_mutex_obj;
-OSMutex *game_enum_mutex = &game_enum_mutex_obj;
+
+// the emulated card has a single file handle, every open/close pair
+// outside of the enum listing has to hold this
+static OSMutex gm_card_mutex_obj;
+static OSMutex *gm_card_mutex = &gm_card_mutex_obj;
+
+// for card users outside this file that hold it a piece at a time
+void gm_card_lock() {
+    OSLockMutex(gm_card_mutex);
+}
+
+void gm_card_unlock() {
+    OSUnlockMutex(gm_card_mutex);
+}
+
+// Cancellation
+// One stop request covers the enum worker, the crawler and the swiss
+// preload. Every loop that touches the card checks it before each access,
+// so stopping waits for a single read at most, not for the whole library.
+#define GM_JOIN_TIMEOUT_MS 250
+#define OS_THREAD_STATE_MORIBUND 8
+
+static volatile bool gm_cancel_requested = false;
+
+bool gm_enum_cancelled() {
+    return gm_cancel_requested;
+}
+
+// checkpoint between card accesses, lets same priority work in first
+static bool gm_enum_yield() {
+    OSYieldThread();
+    return gm_cancel_requested;
+}
+
+// Joins a thread that was asked to stop. It is promoted above the caller
+// so it reaches its next checkpoint now rather than when the menu idles.
+// Only a single card access outliving the timeout falls back to a plain join.
+static void gm_join_thread(OSThread *thread, const char *name) {
+    if (thread->state == 0) return; // never started or already joined
+
+    u64 start_time = gettime();
+    BOOL enabled = OSDisableInterrupts();
+    __OSPromoteThread(thread, OSGetCurrentThread()->effective_priority - 1);
+    OSRestoreInterrupts(enabled);
+
+    while (thread->state != OS_THREAD_STATE_MORIBUND) {
+        if (diff_msec(start_time, gettime()) > GM_JOIN_TIMEOUT_MS) {
+            OSReport("WARNING: %s thread is still busy, waiting\n", name);
+            break;
+        }
+        OSYieldThread();
+    }
+
+    OSJoinThread(thread, NULL);
+
+    u32 waited = diff_msec(start_time, gettime());
+    OSReport("Stopped %s thread in %ums\n", name, waited);
+    (void)waited;
+}
 
 char game_enum_path[128] = {0};
 bool game_enum_running = false;
 
-// TODO: use a log2 malloc copy strategy for this
-__attribute_data_lowmem__ static gm_path_entry_t __gm_early_path_list[2000];
-__attribute_data_lowmem__ static gm_path_entry_t *__gm_sorted_path_list[2000];
-__attribute_data_lowmem__ static gm_file_entry_t *gm_entry_backing[2000];
+// Entry store
+// Records are appended to a flat pool and never move, sorting only shuffles
+// the order indexes. Leaf names and title sort keys go into a string arena
+// behind the directory prefix, which is written once at the start of every
+// listing. The arena is sized for a full pool of titled games with typical
+// dump names (about 70 bytes each), whichever runs out first ends the listing.
+#define GM_NAME_ARENA_SIZE (896 * 1024)
+
+__attribute_data_lowmem__ static gm_file_entry_t gm_entry_pool[GM_MAX_ENTRIES];
+// sorted by name, the renderer reads this while the enum thread inserts
+__attribute_data_lowmem__ static u16 gm_entry_order[GM_MAX_ENTRIES];
+__attribute_data_lowmem__ static char gm_name_arena[GM_NAME_ARENA_SIZE];
 
 static u32 gm_entry_count = 0;
+static u32 gm_name_arena_used = 0;
+
+// listing signature, only complete listings are kept in the directory cache
+static u32 gm_list_sig = 0;
+static bool gm_list_complete = false;
+
+// (game id, disc) -> pool slot, pairs up multi-disc games while listing
+#define GM_DISC_INDEX_SIZE 16384 // power of two, a full pool leaves it a quarter empty
+
+__attribute_data_lowmem__ static game_index_slot_t gm_disc_index_slots[GM_DISC_INDEX_SIZE];
+static game_index_t gm_disc_index;
+
+_Static_assert(GM_DISC_INDEX_SIZE >= GM_MAX_ENTRIES * 4 / 3);
+
+static inline gm_file_entry_t *gm_entry_at(int index) {
+    return &gm_entry_pool[gm_entry_order[index]];
+}
+
+static inline const char *gm_entry_name(gm_file_entry_t *entry) {
+    return &gm_name_arena[entry->name];
+}
+
+// only titles are kept in the arena, file name keys are cheap to make again
+static const char *gm_entry_sort_key(gm_file_entry_t *entry, char *buf) {
+    if (entry->sort_key != 0) return &gm_name_arena[entry->sort_key];
+
+    sort_key_make(buf, gm_entry_name(entry), entry->type != GM_FILE_TYPE_DIRECTORY);
+    return buf;
+}
 
 gm_file_entry_t *gm_get_game_entry(int index) {
     if (index >= gm_entry_count) return NULL;
-    return gm_entry_backing[index];
+    return gm_entry_at(index);
 }
 
-__attribute_aligned_data_lowmem__ static gm_icon_buf_t gm_icon_pool[ASSET_BUFFER_COUNT] = {};
-__attribute_aligned_data_lowmem__ static gm_banner_buf_t gm_banner_pool[ASSET_BUFFER_COUNT] = {};
+static void gm_arena_reset(const char *dir) {
+    strcpy(gm_name_arena, dir);
+    gm_name_arena_used = strlen(dir) + 1;
+}
 
-static inline gm_icon_buf_t *gm_get_icon_buf() {
-    for (int i = 0; i < ASSET_BUFFER_COUNT; i++) {
-        if (gm_icon_pool[i].used == 0) {
-            OSReport("Allocating icon buffer\n");
-            gm_icon_pool[i].used = 1;
-            return &gm_icon_pool[i];
-        }
-    }
+// returns the arena offset, 0 when the arena is full
+static u32 gm_arena_put(const char *str) {
+    u32 len = strlen(str) + 1;
+    if (gm_name_arena_used + len > GM_NAME_ARENA_SIZE) return 0;
 
-    return NULL;
+    u32 offset = gm_name_arena_used;
+    memcpy(&gm_name_arena[offset], str, len);
+    gm_name_arena_used += len;
+    return offset;
 }
 
-static inline void gm_free_icon_buf(gm_icon_buf_t *buf) {
-    if (buf == NULL) return;
-    buf->used = 0;
+char *gm_entry_path(gm_file_entry_t *entry, char *buf) {
+    strcpy(buf, gm_name_arena); // directory prefix
+    strcat(buf, gm_entry_name(entry));
+    return buf;
 }
 
-static int gm_count_icon_buf() {
-    int count = 0;
-    for (int i = 0; i < ASSET_BUFFER_COUNT; i++) {
-        if (gm_icon_pool[i].used == 1) count++;
-    }
+// the catalog record of the last entry asked for, so the menu does not go
+// to ARAM every frame while the banner is on its way
+static gm_file_entry_t *gm_desc_entry = NULL;
+static gm_extra_t gm_desc_extra; // the store is reused by the next listing
+static BNRDesc gm_desc_cached;
+
+static bool gm_entry_catalog_desc(gm_file_entry_t *entry, BNRDesc *desc) {
+    BOOL enabled = OSDisableInterrupts();
+    bool hit = gm_desc_entry == entry && memcmp(&gm_desc_extra, &entry->extra, sizeof(gm_extra_t)) == 0;
+    if (hit) memcpy(desc, &gm_desc_cached, sizeof(BNRDesc));
+    OSRestoreInterrupts(enabled);
+    if (hit) return true;
+
+    // a miss is not kept, the enum thread may probe the game any moment
+    catalog_entry_t record;
+    char path[128];
+    if (!catalog_lookup(gm_entry_path(entry, path), entry->extra.file_size, entry->extra.file_mtime, &record))
+        return false;
+    if (record.desc.fullGameName[0] == 0 && record.desc.gameName[0] == 0)
+        return false; // no banner, the file name is the better title
 
-    return count;
+    memcpy(desc, &record.desc, sizeof(BNRDesc));
+    enabled = OSDisableInterrupts();
+    gm_desc_entry = entry;
+    memcpy(&gm_desc_extra, &entry->extra, sizeof(gm_extra_t));
+    memcpy(&gm_desc_cached, desc, sizeof(BNRDesc));
+    OSRestoreInterrupts(enabled);
+
+    return true;
 }
 
-static inline gm_banner_buf_t *gm_get_banner_buf() {
-    for (int i = 0; i < ASSET_BUFFER_COUNT; i++) {
-        if (gm_banner_pool[i].used == 0) {
-            gm_banner_pool[i].used = 1;
-            return &gm_banner_pool[i];
+// The description of a game is only kept next to its banner texture, the
+// catalog record stands in until that is loaded, then the file name. Only
+// the selected entry is asked for (menu text, card game id), it is on
+// screen so its banner stays.
+void gm_entry_desc(gm_file_entry_t *entry, BNRDesc *desc) {
+    memset(desc, 0, sizeof(BNRDesc));
+
+    if (entry->type == GM_FILE_TYPE_GAME) {
+        gm_banner_buf_t *buf = entry->asset.banner.buf;
+        if (entry->asset.banner.state == GM_LOAD_STATE_LOADED && buf != NULL) {
+            memcpy(desc, &buf->desc, sizeof(BNRDesc));
+            return;
         }
-    }
 
-    return NULL;
-}
+        if (entry->meta_ready && gm_entry_catalog_desc(entry, desc))
+            return;
+    }
 
-static inline void gm_free_banner_buf(gm_banner_buf_t *buf) {
-    if (buf == NULL) return;
-    buf->used = 0;
+    strncpy(desc->fullGameName, gm_entry_name(entry), sizeof(desc->fullGameName) - 1);
+    if (entry->type == GM_FILE_TYPE_PROGRAM) {
+        strcpy(desc->description, "Homebrew Program");
+    } else if (entry->type == GM_FILE_TYPE_DIRECTORY) {
+        strcpy(desc->description, "Directory");
+    }
 }
 
-static int gm_count_banner_buf() {
-    int count = 0;
-    for (int i = 0; i < ASSET_BUFFER_COUNT; i++) {
-        if (gm_banner_pool[i].used == 1) count++;
+void gm_get_boot_entry(gm_file_entry_t *entry, gm_boot_entry_t *boot, gm_boot_entry_t *second) {
+    gm_entry_path(entry, boot->path);
+    boot->type = entry->type;
+    memcpy(&boot->extra, &entry->extra, sizeof(gm_extra_t));
+    boot->second = NULL;
+
+    if (entry->second != NULL && second != NULL) {
+        gm_entry_path(entry->second, second->path);
+        second->type = entry->second->type;
+        memcpy(&second->extra, &entry->second->extra, sizeof(gm_extra_t));
+        second->second = boot;
+        boot->second = second;
     }
-
-    return count;
 }
 
-static int gm_count_pending_free() {
-    int count = 0;
-    for (int i = 0; i < gm_entry_count; i++) {
-        gm_file_entry_t *entry = gm_entry_backing[i];
-        count += entry->asset.icon.schedule_free;
-        count += entry->asset.banner.schedule_free;
+// Asset buffer pools
+// Occupancy is a bitmap per pool, a set bit is a buffer in use, so the
+// first free one is a count leading zeros away. When a pool runs dry the
+// loader gives up the line farthest from the screen, see gm_asset_evict.
+#define GM_POOL_WORDS (ASSET_BUFFER_COUNT / 32)
+
+typedef struct {
+    u32 used_map[GM_POOL_WORDS];
+    u32 used;
+    u32 peak;
+    u32 traced; // last value sent to the profiler
+} gm_pool_t;
+
+_Static_assert(ASSET_BUFFER_COUNT % 32 == 0);
+_Static_assert(offsetof(gm_banner_buf_t, desc) + sizeof(BNRDesc) == BNR_PIXELS_DESC_LEN);
+
+__attribute_aligned_data_lowmem__ static gm_icon_buf_t gm_icon_pool[ASSET_BUFFER_COUNT];
+__attribute_aligned_data_lowmem__ static gm_banner_buf_t gm_banner_pool[ASSET_BUFFER_COUNT];
+static gm_pool_t gm_icon_pool_map;
+static gm_pool_t gm_banner_pool_map;
+
+static bool gm_asset_evict();
+
+// the unload callbacks free from interrupt context
+static int gm_pool_alloc(gm_pool_t *pool) {
+    BOOL enabled = OSDisableInterrupts();
+    for (int w = 0; w < GM_POOL_WORDS; w++) {
+        u32 free_bits = ~pool->used_map[w];
+        if (free_bits == 0) continue;
+
+        int bit = __builtin_clz(free_bits);
+        pool->used_map[w] |= 0x80000000u >> bit;
+        if (++pool->used > pool->peak) pool->peak = pool->used;
+
+        OSRestoreInterrupts(enabled);
+        return (w * 32) + bit;
     }
+    OSRestoreInterrupts(enabled);
 
-    return count;
+    return -1;
 }
 
-// TODO: swap the icon/banner callback with req->owner checks
-static void arq_icon_callback_setup(u32 arq_request_ptr) {
-    // OSReport("CALLBACK arq_icon_callback_setup\n");
-    ARQRequest *req = (ARQRequest*)arq_request_ptr;
-    gm_icon_t *icon = (gm_icon_t*)req;
+static void gm_pool_free(gm_pool_t *pool, int index) {
+    u32 mask = 0x80000000u >> (index % 32);
 
-    icon->state = GM_LOAD_STATE_LOADED;
-    DCFlushRange(icon, sizeof(gm_icon_t));
+    BOOL enabled = OSDisableInterrupts();
+    if (pool->used_map[index / 32] & mask) {
+        pool->used_map[index / 32] &= ~mask;
+        pool->used--;
+    } else {
+        OSReport("ERROR: double free of pool buffer %d\n", index);
+    }
+    OSRestoreInterrupts(enabled);
 }
 
-static void arq_icon_callback_unload(u32 arq_request_ptr) {
-    // OSReport("CALLBACK arq_icon_callback_unload\n");
-    ARQRequest *req = (ARQRequest*)arq_request_ptr;
-    gm_icon_t *icon = (gm_icon_t*)req;
-
-    icon->state = GM_LOAD_STATE_UNLOADED;
-    gm_free_icon_buf(icon->buf);
-    DCFlushRange(icon, sizeof(gm_icon_t));
+// every buffer goes back at once, for a listing that is thrown away whole
+static void gm_pool_reset(gm_pool_t *pool) {
+    BOOL enabled = OSDisableInterrupts();
+    memset(pool->used_map, 0, sizeof(pool->used_map));
+    pool->used = 0;
+    OSRestoreInterrupts(enabled);
 }
 
-static void arq_icon_callback_load(u32 arq_request_ptr) {
-    // OSReport("CALLBACK arq_icon_callback_load\n");
-    ARQRequest *req = (ARQRequest*)arq_request_ptr;
-    gm_icon_t *icon = (gm_icon_t*)req;
+static gm_icon_buf_t *gm_get_icon_buf() {
+    int index = gm_pool_alloc(&gm_icon_pool_map);
+    while (index < 0 && gm_asset_evict()) {
+        index = gm_pool_alloc(&gm_icon_pool_map);
+    }
 
-    icon->state = GM_LOAD_STATE_LOADED;
-    DCFlushRange(icon, sizeof(gm_icon_t));
+    return index < 0 ? NULL : &gm_icon_pool[index];
 }
 
-static void arq_banner_callback_setup(u32 arq_request_ptr) {
-    // OSReport("CALLBACK arq_banner_callback_setup\n");
-    ARQRequest *req = (ARQRequest*)arq_request_ptr;
-    gm_banner_t *banner = (gm_banner_t*)req;
-
-    banner->state = GM_LOAD_STATE_LOADED;
-    DCFlushRange(banner, sizeof(gm_banner_t));
+static inline void gm_free_icon_buf(gm_icon_buf_t *buf) {
+    if (buf == NULL) return;
+    gm_pool_free(&gm_icon_pool_map, buf - gm_icon_pool);
 }
 
-static void arq_banner_callback_unload(u32 arq_request_ptr) {
-    // OSReport("CALLBACK arq_banner_callback_unload\n");
-    ARQRequest *req = (ARQRequest*)arq_request_ptr;
-    gm_banner_t *banner = (gm_banner_t*)req;
-
-    banner->state = GM_LOAD_STATE_UNLOADED;
-    gm_free_banner_buf(banner->buf);
-    DCFlushRange(banner, sizeof(gm_banner_t));
+static int gm_count_icon_buf() {
+    return gm_icon_pool_map.used;
 }
 
-static void arq_banner_callback_load(u32 arq_request_ptr) {
-    // OSReport("CALLBACK arq_banner_callback_load\n");
-    ARQRequest *req = (ARQRequest*)arq_request_ptr;
-    gm_banner_t *banner = (gm_banner_t*)req;
+static gm_banner_buf_t *gm_get_banner_buf() {
+    int index = gm_pool_alloc(&gm_banner_pool_map);
+    while (index < 0 && gm_asset_evict()) {
+        index = gm_pool_alloc(&gm_banner_pool_map);
+    }
 
-    banner->state = GM_LOAD_STATE_LOADED;
-    DCFlushRange(banner, sizeof(gm_banner_t));
+    return index < 0 ? NULL : &gm_banner_pool[index];
 }
 
-// asset offload helpers
-void gm_icon_setup(gm_icon_t *icon, u32 aram_offset) {
-    OSReport("Setting up icon\n");
-    icon->aram_offset = aram_offset;
-    icon->state = GM_LOAD_STATE_SETUP;
-
-    ARQRequest *req = &icon->req;
-    u32 owner = make_type('I', 'X', 'X', 'S');
-    u32 type = ARAM_DIR_MRAM_TO_ARAM;
-    u32 priority = ARQ_PRIORITY_LOW;
-    u32 source = (u32)icon->buf->data;
-    u32 dest = aram_offset;
-    u32 length = ICON_PIXELDATA_LEN;
+static inline void gm_free_banner_buf(gm_banner_buf_t *buf) {
+    if (buf == NULL) return;
+    gm_pool_free(&gm_banner_pool_map, buf - gm_banner_pool);
+}
 
-    dolphin_ARQPostRequest(req, owner, type, priority, source, dest, length, &arq_icon_callback_setup);
+static int gm_count_banner_buf() {
+    return gm_banner_pool_map.used;
 }
 
-void gm_icon_setup_unload(gm_icon_t *icon, u32 aram_offset) {
-    icon->aram_offset = aram_offset;
-    icon->state = GM_LOAD_STATE_UNLOADING;
+// occupancy for the trace, only when it moved
+static void gm_pool_trace() {
+    if (gm_icon_pool_map.used != gm_icon_pool_map.traced) {
+        gm_icon_pool_map.traced = gm_icon_pool_map.used;
+        trace_counter(TRACE_POOL_ICONS, gm_icon_pool_map.used);
+    }
+    if (gm_banner_pool_map.used != gm_banner_pool_map.traced) {
+        gm_banner_pool_map.traced = gm_banner_pool_map.used;
+        trace_counter(TRACE_POOL_BANNERS, gm_banner_pool_map.used);
+    }
+}
 
-    ARQRequest *req = &icon->req;
-    u32 owner = make_type('I', 'C', 'O', 'U');
-    u32 type = ARAM_DIR_MRAM_TO_ARAM;
-    u32 priority = ARQ_PRIORITY_LOW;
-    u32 source = (u32)icon->buf->data;
-    u32 dest = aram_offset;
-    u32 length = ICON_PIXELDATA_LEN;
+static int gm_count_pending_free() {
+    int count = 0;
+    for (int i = 0; i < gm_entry_count; i++) {
+        gm_file_entry_t *entry = gm_entry_at(i);
+        count += entry->asset.icon.schedule_free;
+        count += entry->asset.banner.schedule_free;
+    }
 
-    dolphin_ARQPostRequest(req, owner, type, priority, source, dest, length, &arq_icon_callback_unload);
+    return count;
 }
 
-void gm_icon_load(gm_icon_t *icon) {
+// asset offload helpers
+
+// joins the line batch, gm_line_load marks it loaded on completion
+void gm_icon_load(gm_icon_t *icon, arq_batch_t *batch, void *tag) {
     // OSReport("Loading icon %d\n", icon->state);
     if (icon->state == GM_LOAD_STATE_SETUP) {
         OSReport("ERROR: banner is still in setup\n");
@@ -236,15 +399,7 @@ void gm_icon_load(gm_icon_t *icon) {
     icon->buf = icon_ptr;
     DCFlushRange(icon, sizeof(gm_icon_t));
 
-    ARQRequest *req = &icon->req;
-    u32 owner = make_type('I', 'C', 'O', 'L');
-    u32 type = ARAM_DIR_ARAM_TO_MRAM;
-    u32 priority = ARQ_PRIORITY_LOW;
-    u32 source = icon->aram_offset;
-    u32 dest = (u32)icon->buf->data;
-    u32 length = ICON_PIXELDATA_LEN;
-
-    dolphin_ARQPostRequest(req, owner, type, priority, source, dest, length, &arq_icon_callback_load);
+    arq_batch_add(batch, ARAM_DIR_ARAM_TO_MRAM, icon->buf->data, icon->aram_offset, ICON_PIXELDATA_LEN, tag);
 }
 
 void gm_icon_free(gm_icon_t *icon) {
@@ -263,67 +418,6 @@ void gm_icon_free(gm_icon_t *icon) {
     icon->state = GM_LOAD_STATE_UNLOADED;
 }
 
-void gm_banner_setup(gm_banner_t *banner, u32 aram_offset) {
-    // OSReport("Setting up banner\n");
-    banner->aram_offset = aram_offset;
-    banner->state = GM_LOAD_STATE_SETUP;
-
-    ARQRequest *req = &banner->req;
-    u32 owner = make_type('B', 'X', 'X', 'S');
-    u32 type = ARAM_DIR_MRAM_TO_ARAM;
-    u32 priority = ARQ_PRIORITY_LOW;
-    u32 source = (u32)banner->buf->data;
-    u32 dest = aram_offset;
-    u32 length = BNR_PIXELDATA_LEN;
-
-    dolphin_ARQPostRequest(req, owner, type, priority, source, dest, length, &arq_banner_callback_setup);
-}
-
-void gm_banner_setup_unload(gm_banner_t *banner, u32 aram_offset) {
-    banner->aram_offset = aram_offset;
-    banner->state = GM_LOAD_STATE_UNLOADING;
-
-    ARQRequest *req = &banner->req;
-    u32 owner = make_type('I', 'X', 'X', 'U');
-    u32 type = ARAM_DIR_MRAM_TO_ARAM;
-    u32 priority = ARQ_PRIORITY_LOW;
-    u32 source = (u32)banner->buf->data;
-    u32 dest = aram_offset;
-    u32 length = BNR_PIXELDATA_LEN;
-
-    dolphin_ARQPostRequest(req, owner, type, priority, source, dest, length, &arq_banner_callback_unload);
-}
-
-void gm_banner_load(gm_banner_t *banner) {
-    // OSReport("Loading banner %d\n", banner->state);
-    if (banner->state == GM_LOAD_STATE_SETUP) {
-        OSReport("ERROR: banner is still in setup\n");
-    }
-    if (banner->state == GM_LOAD_STATE_UNLOADING) {
-        OSReport("ERROR: banner is still in unload\n");
-    }
-    if (banner->state == GM_LOAD_STATE_NONE || banner->state == GM_LOAD_STATE_LOADED) return;
-    banner->state = GM_LOAD_STATE_LOADING;
-
-    gm_banner_buf_t *banner_ptr = gm_get_banner_buf();
-    if (banner_ptr == NULL) {
-        OSReport("ERROR: could not allocate memory\n");
-        return;
-    }
-    banner->buf = banner_ptr;
-    DCFlushRange(banner, sizeof(gm_banner_t));
-
-    ARQRequest *req = &banner->req;
-    u32 owner = make_type('I', 'X', 'X', 'L');
-    u32 type = ARAM_DIR_ARAM_TO_MRAM;
-    u32 priority = ARQ_PRIORITY_LOW;
-    u32 source = banner->aram_offset;
-    u32 dest = (u32)banner->buf->data;
-    u32 length = BNR_PIXELDATA_LEN;
-
-    dolphin_ARQPostRequest(req, owner, type, priority, source, dest, length, &arq_banner_callback_load);
-}
-
 void gm_banner_free(gm_banner_t *banner) {
     if (banner->state == GM_LOAD_STATE_NONE || banner->state == GM_LOAD_STATE_UNLOADING) {
         if (banner->state == GM_LOAD_STATE_UNLOADING) OSReport("ERROR: banner is unloading??\n");
@@ -343,21 +437,13 @@ void gm_banner_free(gm_banner_t *banner) {
     banner->state = GM_LOAD_STATE_UNLOADED;
 }
 
-// HEAP
-pmalloc_t pmblock;
-pmalloc_t *pm = &pmblock;
-__attribute_aligned_data_lowmem__ static u8 gm_heap_buffer[2 * 1024 * 1024];
-
-// MACROS
-#define gm_malloc(x) pmalloc_memalign(pm, x, 32);
-#define gm_free(x) pmalloc_freealign(pm, x);
+// drops the texture and the pin taken in gm_banner_texture
+static void gm_banner_release(gm_file_entry_t *entry) {
+    if (entry->asset.banner.state == GM_LOAD_STATE_LOADED) {
+        bnr_cache_pin(entry->extra.game_id, entry->extra.disc_num, false);
+    }
 
-void gm_init_heap() {
-    OSReport("Initializing heap [%x]\n", sizeof(gm_heap_buffer));
-    
-    // Initialise our pmalloc
-	pmalloc_init(pm);
-	pmalloc_addblock(pm, &gm_heap_buffer[0], sizeof(gm_heap_buffer));
+    gm_banner_free(&entry->asset.banner);
 }
 
 #if 0
@@ -471,11 +557,213 @@ static bool check_file_hidden(const char *name) {
     return false;
 }
 
-int gm_cmp_path_entry(const void* ptr_a, const void* ptr_b){
-    const gm_path_entry_t *obj_a = *(gm_path_entry_t**)ptr_a;
-    const gm_path_entry_t *obj_b = *(gm_path_entry_t**)ptr_b;
+// the type of a listed entry, unknown for anything that is not shown
+static gm_file_type_t gm_list_filter(const char *target_dir, file_entry_t *ent) {
+    if (ent->attrib & FILE_ATTRIB_FLAG_HIDDEN) return GM_FILE_TYPE_UNKNOWN;
+    if (check_file_hidden(ent->name)) return GM_FILE_TYPE_UNKNOWN;
+    if (strlen(target_dir) + strlen(ent->name) >= sizeof(((gm_path_entry_t*)0)->path)) return GM_FILE_TYPE_UNKNOWN;
+
+    // only check file ext for now
+    if (ent->type == FILE_ENTRY_TYPE_DIR) return GM_FILE_TYPE_DIRECTORY;
+    return gm_get_file_type(ent->name);
+}
+
+// changes whenever a shown entry is added, removed, renamed or rewritten
+static u32 gm_list_sig_update(u32 sig, file_entry_t *ent) {
+    u32 stamp[2] = { (u32)ent->size, (ent->date << 16) | ent->time };
+    sig = tinf_crc32_update(sig, ent->name, strlen(ent->name));
+    return tinf_crc32_update(sig, stamp, sizeof(stamp));
+}
+
+static void gm_fill_extra(gm_extra_t *extra, dolphin_game_into_t *info) {
+    memcpy(extra->game_id, info->game_id, sizeof(extra->game_id));
+    extra->disc_num = info->disc_num;
+    extra->disc_ver = info->disc_ver;
+    extra->dvd_bnr_offset = info->bnr_offset;
+    extra->dvd_bnr_type = info->bnr_type;
+    extra->dvd_dol_offset = info->dol_offset;
+    extra->dvd_fst_offset = info->fst_offset;
+    extra->dvd_fst_size = info->fst_size;
+    extra->dvd_max_fst_size = info->max_fst_size;
+}
+
+void gm_setup_grid(int line_count, bool initial) {
+    int line_total = (line_count + 7) >> 3;
+    if (line_total < 4) {
+        line_total = 4;
+    }
+
+    if (initial) {
+        // Setup the grid
+        number_of_lines = line_total;
+        grid_setup_func();
+    } else {
+        grid_extend_lines(line_total);
+    }
+}
+
+// links disc 1 and disc 2 as soon as both ids are known, safe to call again
+static void gm_index_disc(gm_file_entry_t *entry) {
+    if (entry->type != GM_FILE_TYPE_GAME || entry->extra.game_id[0] == 0) return;
+
+    u8 *game_id = entry->extra.game_id;
+    u8 disc_num = entry->extra.disc_num;
+    u32 slot = entry - &gm_entry_pool[0];
+
+    u32 other;
+    if (entry->second == NULL && disc_num <= 1 && game_index_get(&gm_disc_index, game_id, disc_num ^ 1, &other)) {
+        gm_file_entry_t *pair = &gm_entry_pool[other];
+        if (pair->second == NULL) {
+            OSReport("Found multi-disc %s + %s\n", gm_entry_name(entry), gm_entry_name(pair));
+            entry->second = pair;
+            pair->second = entry;
+        }
+    }
+
+    // the first dump with this id keeps the slot
+    u32 existing;
+    if (!game_index_get(&gm_disc_index, game_id, disc_num, &existing)) {
+        game_index_put(&gm_disc_index, game_id, disc_num, slot);
+    }
+}
+
+// the key of the banner title, false when the probe found none
+static bool gm_make_title_key(gm_file_entry_t *entry, BNRDesc *desc, char *key) {
+    if (entry->type != GM_FILE_TYPE_GAME || entry->extra.dvd_bnr_offset == 0) return false;
 
-    return strcasecmp(obj_a->path, obj_b->path);
+    if (desc->fullGameName[0] != 0) {
+        sort_key_make(key, desc->fullGameName, false);
+    } else if (desc->gameName[0] != 0) {
+        sort_key_make(key, desc->gameName, false);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// keys first, equal keys fall back to the file name so the order is stable
+static int gm_entry_cmp(gm_file_entry_t *a, gm_file_entry_t *b, const char *b_key) {
+    char a_buf[SORT_KEY_LEN];
+    int res = strcmp(gm_entry_sort_key(a, a_buf), b_key);
+    if (res != 0) return res;
+    return strcasecmp(gm_entry_name(a), gm_entry_name(b));
+}
+
+// first index that sorts after entry
+static int gm_insert_pos(gm_file_entry_t *entry) {
+    char key_buf[SORT_KEY_LEN];
+    const char *key = gm_entry_sort_key(entry, key_buf);
+
+    int lo = 0;
+    int hi = gm_entry_count;
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+        if (gm_entry_cmp(gm_entry_at(mid), entry, key) <= 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Moves an entry whose key changed (a title came in) to its new spot.
+// The old key stays behind in the arena, a full arena keeps the old order.
+// Returns true when it moved.
+static bool gm_resort_entry(gm_file_entry_t *entry, BNRDesc *desc) {
+    char key[SORT_KEY_LEN];
+    if (!gm_make_title_key(entry, desc, key)) return false;
+
+    char old_buf[SORT_KEY_LEN];
+    if (strcmp(key, gm_entry_sort_key(entry, old_buf)) == 0) return false;
+
+    u32 key_offset = gm_arena_put(key);
+    if (key_offset == 0) return false;
+
+    u16 slot = entry - &gm_entry_pool[0];
+
+    BOOL enabled = OSDisableInterrupts();
+    int pos = 0;
+    while (pos < gm_entry_count && gm_entry_order[pos] != slot) pos++;
+    if (pos == gm_entry_count) {
+        OSRestoreInterrupts(enabled);
+        return false;
+    }
+
+    gm_entry_count--;
+    memmove(&gm_entry_order[pos], &gm_entry_order[pos + 1], (gm_entry_count - pos) * sizeof(u16));
+    entry->sort_key = key_offset;
+
+    int new_pos = gm_insert_pos(entry);
+    memmove(&gm_entry_order[new_pos + 1], &gm_entry_order[new_pos], (gm_entry_count - new_pos) * sizeof(u16));
+    gm_entry_order[new_pos] = slot;
+    gm_entry_count++;
+    OSRestoreInterrupts(enabled);
+
+    return new_pos != pos;
+}
+
+// Inserts the entry in sorted position and grows the grid to match.
+// Interrupts are off so the renderer never sees a half shifted list.
+static void gm_publish_entry(gm_file_entry_t *entry) {
+    int pos = gm_insert_pos(entry);
+
+    BOOL enabled = OSDisableInterrupts();
+    memmove(&gm_entry_order[pos + 1], &gm_entry_order[pos], (gm_entry_count - pos) * sizeof(u16));
+    gm_entry_order[pos] = entry - &gm_entry_pool[0];
+    gm_entry_count++;
+    game_backing_count = gm_entry_count;
+    gm_setup_grid(gm_entry_count, false);
+    OSRestoreInterrupts(enabled);
+}
+
+// NULL when the store or the arena is full
+static gm_file_entry_t *gm_new_entry(gm_path_entry_t *path_entry) {
+    if (gm_entry_count >= GM_MAX_ENTRIES) return NULL;
+
+    char *base = strrchr(path_entry->path, '/');
+    u32 name = gm_arena_put(base ? base + 1 : path_entry->path);
+    if (name == 0) return NULL;
+
+    // records are only handed out in order, the next one is never published yet
+    gm_file_entry_t *backing = &gm_entry_pool[gm_entry_count];
+    memset(backing, 0, sizeof(gm_file_entry_t));
+
+    backing->name = name;
+    backing->type = path_entry->type;
+
+    // Games, only the enum thread makes entries
+    static catalog_entry_t cached;
+    bool cached_hit = false;
+    if (path_entry->type == GM_FILE_TYPE_GAME) {
+        memcpy(&backing->extra, &path_entry->extra, sizeof(gm_extra_t));
+        backing->meta_ready = false;          // metadata not ready yet.
+        backing->asset.use_banner = true;    // default assumption
+
+        // unchanged since it was last probed, no need to open it
+        cached_hit = catalog_lookup(path_entry->path, path_entry->extra.file_size, path_entry->extra.file_mtime, &cached);
+        if (cached_hit) {
+            memcpy(&backing->extra, &cached.extra, sizeof(gm_extra_t));
+            backing->meta_ready = true;
+        }
+    } else {
+        // Programs and directories
+        backing->meta_ready = true; // no validation needed
+        backing->asset.use_banner = false;
+    }
+
+    // a title from the catalog sorts it right away
+    char key[SORT_KEY_LEN];
+    if (cached_hit && gm_make_title_key(backing, &cached.desc, key)) {
+        backing->sort_key = gm_arena_put(key);
+        if (backing->sort_key == 0) {
+            gm_name_arena_used = name; // drop the name again
+            return NULL;
+        }
+    }
+
+    gm_index_disc(backing);
+    return backing;
 }
 
 // DEFS
@@ -493,6 +781,7 @@ gm_list_info gm_list_files(const char *target_dir) {
     // List all of the games in target_dir and sort them by name (only including certain file extensions)
     OSReport("Listing files in %s\n", target_dir);
     u64 start_time = gettime();
+    trace_begin(TRACE_ENUM_LIST);
 
     int res = dvd_custom_open(target_dir, FILE_ENTRY_TYPE_DIR, 0);
     if (res != 0) {
@@ -509,29 +798,37 @@ gm_list_info gm_list_files(const char *target_dir) {
 
     uint8_t dir_fd = status->fd;
     OSReport("found readdir fd=%u\n", dir_fd);
+    gm_arena_reset(target_dir);
+    game_index_init(&gm_disc_index, gm_disc_index_slots, GM_DISC_INDEX_SIZE);
 
-    // now list everything
+    // now list everything, game headers come along with the directory entries
     static GCN_ALIGNED(file_entry_t) ent;
+    __attribute__((aligned(32))) static DiskHeader header;
+    static gm_path_entry_t path_entry;
     int path_entry_count = 0;
     char file_full_path_buf[128] = {0};
+    gm_list_sig = 0;
+    gm_list_complete = false;
 
     // TODO: switch to using DVD Mutex (this is all happening in a thread)
     while(1) {
-        int ret = dvd_custom_readdir(&ent, dir_fd);
-        if (ret != 0) ipl_panic();
-        if (ent.name[0] == 0) break; // end of directory
-        if (ent.attrib & FILE_ATTRIB_FLAG_HIDDEN) continue; // skip hidden files
-        if (check_file_hidden(ent.name)) continue; // skip hidden files
+        if (gm_enum_yield()) {
+            OSReport("STOPPING GAME LOADING\n");
+            break;
+        }
 
-        // only check file ext for now
-        gm_file_type_t file_type = GM_FILE_TYPE_UNKNOWN;
-        if (ent.type == FILE_ENTRY_TYPE_DIR) {
-            file_type = GM_FILE_TYPE_DIRECTORY;
-        } else {
-            file_type = gm_get_file_type(ent.name);
+        u32 header_len = 0;
+        int ret = dvd_custom_readdir_header(&ent, &header, sizeof(DiskHeader), &header_len, dir_fd);
+        if (ret != 0) ipl_panic();
+        if (ent.name[0] == 0) {
+            gm_list_complete = true;
+            break; // end of directory
         }
 
-        if (file_type == GM_FILE_TYPE_UNKNOWN) continue; // check if the file is valid
+        // hidden, unknown extension or too long
+        gm_file_type_t file_type = gm_list_filter(target_dir, &ent);
+        if (file_type == GM_FILE_TYPE_UNKNOWN) continue;
+        gm_list_sig = gm_list_sig_update(gm_list_sig, &ent);
 
 #ifdef PRINT_READDIR_NAMES
         // logging
@@ -547,81 +844,382 @@ gm_list_info gm_list_files(const char *target_dir) {
 #endif
 
         // store the path
-        gm_path_entry_t *entry = &__gm_early_path_list[path_entry_count];
+        gm_path_entry_t *entry = &path_entry;
         strcpy(entry->path, file_full_path_buf);
         entry->type = file_type;
+        memset(&entry->extra, 0, sizeof(gm_extra_t));
+        entry->extra.file_size = (u32)ent.size;
+        entry->extra.file_mtime = (ent.date << 16) | ent.time;
 
-        // setup sort list
-        __gm_sorted_path_list[path_entry_count] = entry;
-        path_entry_count++;
+        if (file_type == GM_FILE_TYPE_GAME && header_len == sizeof(DiskHeader)) {
+            dolphin_game_into_t info = get_game_info_fast(&header);
+            if (info.valid) gm_fill_extra(&entry->extra, &info);
+        }
 
-        if (path_entry_count >= 1920) {
+        // visible right away, metadata and banners follow later
+        gm_file_entry_t *backing = gm_new_entry(entry);
+        if (backing == NULL) {
             OSReport("WARNING: Too many files in directory\n");
             break;
         }
+
+        gm_publish_entry(backing);
+        path_entry_count++;
     }
 
     dvd_custom_close(dir_fd);
 
     f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
-    OSReport("File enum completed! took=%f (%d)\n", runtime, game_backing_count);
+    OSReport("File enum completed! took=%f (%d)\n", runtime, path_entry_count);
     (void)runtime;
+    trace_end(TRACE_ENUM_LIST, path_entry_count);
 
     return (gm_list_info){path_entry_count};
 }
 
-void gm_sort_files(int path_count) {
-    // Sort the paths by name
+// The store, the arena and the buffer pools are all reset in bulk, the
+// records are cleared when they are handed out again. Only called with the
+// asset loader stopped, so no transfer still points into the pools.
+static void gm_reset_entries() {
+    BOOL enabled = OSDisableInterrupts();
+    gm_entry_count = 0;
+    game_backing_count = 0;
+    OSRestoreInterrupts(enabled);
+
+    gm_pool_reset(&gm_icon_pool_map);
+    gm_pool_reset(&gm_banner_pool_map);
+    bnr_cache_unpin_all();
+
+    number_of_lines = 0;
+    DCBlockStore((void*)OSRoundDown32B((u32)&number_of_lines));
+    DCBlockStore((void*)OSRoundDown32B((u32)&game_backing_count));
+}
+
+// Directory cache
+// Completed listings are kept in ARAM so going back to a directory shows
+// the same grid at the same scroll position right away. Only what the
+// listing produced is kept, descriptions come back with the banners from
+// the banner cache. A readdir pass in the background compares the
+// listing signature and lists again when anything changed.
+#define GM_DIR_CACHE_SLOTS 8
+#define GM_DIR_CACHE_ARAM_SIZE (512 * 1024)
+#define GM_DIR_CACHE_CHUNK (8 * 1024)
+
+typedef struct {
+    u32 name;
+    u32 sort_key; // both are arena offsets, the arena is kept whole
+    gm_extra_t extra;
+    u8 type;
+    u8 meta_ready;
+    u8 padding[2];
+} gm_dir_record_t;
+
+typedef struct {
+    char path[128];
+    u32 sig;
+    u32 aram_offset;
+    u32 length;
+    u32 entry_count;
+    u32 arena_used;
+    int top_line;
+    int selected_slot;
+    u32 last_used;
+    bool valid;
+} gm_dir_cache_t;
+
+static gm_dir_cache_t gm_dir_cache[GM_DIR_CACHE_SLOTS];
+static u32 gm_dir_cache_base = ARAM_NONE; // taken at init, before banners fill ARAM
+static u32 gm_dir_cache_clock = 0;
+static bool gm_dir_restored = false;
+
+__attribute_aligned_data_lowmem__ static u8 gm_dir_cache_buf[GM_DIR_CACHE_CHUNK];
+
+typedef struct {
+    u32 aram_offset;
+    u32 len; // bytes in the chunk buffer
+    bool write;
+} gm_dir_stream_t;
+
+static volatile bool gm_dir_dma_bsy = false;
+static void gm_dir_dma_cb(u32 arq_request_ptr) {
+    gm_dir_dma_bsy = false;
+}
+
+static void gm_dir_dma(u32 type, u32 aram_offset, u32 len) {
+    static ARQRequest req;
+    u32 owner = ARAM_OWNER_DIRS;
+    u32 source = type == ARAM_DIR_MRAM_TO_ARAM ? (u32)gm_dir_cache_buf : aram_offset;
+    u32 dest = type == ARAM_DIR_MRAM_TO_ARAM ? aram_offset : (u32)gm_dir_cache_buf;
+
+    gm_dir_dma_bsy = true;
+    if (type == ARAM_DIR_MRAM_TO_ARAM) {
+        DCFlushRange(gm_dir_cache_buf, len);
+    } else {
+        DCInvalidateRange(gm_dir_cache_buf, len);
+    }
+    dolphin_ARQPostRequest(&req, owner, type, ARQ_PRIORITY_LOW, source, dest, len, &gm_dir_dma_cb);
+    while (gm_dir_dma_bsy)
+        OSYieldThread();
+}
+
+static void gm_dir_stream_flush(gm_dir_stream_t *stream) {
+    if (stream->len == 0) return;
+
+    gm_dir_dma(ARAM_DIR_MRAM_TO_ARAM, stream->aram_offset, OSRoundUp32B(stream->len));
+    stream->aram_offset += GM_DIR_CACHE_CHUNK;
+    stream->len = 0;
+}
+
+// the snapshot is one byte stream, staged through the chunk buffer
+static void gm_dir_stream_copy(gm_dir_stream_t *stream, void *data, u32 len) {
+    u8 *ptr = data;
+    while (len > 0) {
+        if (!stream->write && stream->len == 0) {
+            gm_dir_dma(ARAM_DIR_ARAM_TO_MRAM, stream->aram_offset, GM_DIR_CACHE_CHUNK);
+            stream->aram_offset += GM_DIR_CACHE_CHUNK;
+        }
+
+        u32 count = GM_DIR_CACHE_CHUNK - stream->len;
+        if (count > len) count = len;
+
+        if (stream->write) {
+            memcpy(&gm_dir_cache_buf[stream->len], ptr, count);
+        } else {
+            memcpy(ptr, &gm_dir_cache_buf[stream->len], count);
+        }
+
+        stream->len += count;
+        ptr += count;
+        len -= count;
+
+        if (stream->len == GM_DIR_CACHE_CHUNK) {
+            if (stream->write) {
+                gm_dir_stream_flush(stream);
+            } else {
+                stream->len = 0;
+            }
+        }
+    }
+}
+
+static gm_dir_cache_t *gm_dir_cache_find(const char *path) {
+    for (int i = 0; i < GM_DIR_CACHE_SLOTS; i++) {
+        if (gm_dir_cache[i].valid && strcmp(gm_dir_cache[i].path, path) == 0)
+            return &gm_dir_cache[i];
+    }
+
+    return NULL;
+}
+
+// first fit between the live snapshots, NULL when nothing fits
+static bool gm_dir_cache_fit(u32 length, u32 *offset) {
+    u32 start = gm_dir_cache_base;
+    while (start + length <= gm_dir_cache_base + GM_DIR_CACHE_ARAM_SIZE) {
+        gm_dir_cache_t *overlap = NULL;
+        for (int i = 0; i < GM_DIR_CACHE_SLOTS; i++) {
+            gm_dir_cache_t *slot = &gm_dir_cache[i];
+            if (!slot->valid) continue;
+            if (slot->aram_offset < start + length && start < slot->aram_offset + slot->length) {
+                overlap = slot;
+                break;
+            }
+        }
+
+        if (overlap == NULL) {
+            *offset = start;
+            return true;
+        }
+        start = overlap->aram_offset + overlap->length;
+    }
+
+    return false;
+}
+
+// evicts the least recently used snapshots until the new one fits
+static gm_dir_cache_t *gm_dir_cache_alloc(u32 length) {
+    if (gm_dir_cache_base == ARAM_NONE || length > GM_DIR_CACHE_ARAM_SIZE) return NULL;
+
+    u32 offset = 0;
+    while (!gm_dir_cache_fit(length, &offset)) {
+        gm_dir_cache_t *oldest = NULL;
+        for (int i = 0; i < GM_DIR_CACHE_SLOTS; i++) {
+            if (gm_dir_cache[i].valid && (oldest == NULL || gm_dir_cache[i].last_used < oldest->last_used))
+                oldest = &gm_dir_cache[i];
+        }
+        oldest->valid = false;
+    }
+
+    gm_dir_cache_t *free_slot = NULL;
+    for (int i = 0; i < GM_DIR_CACHE_SLOTS; i++) {
+        gm_dir_cache_t *slot = &gm_dir_cache[i];
+        if (!slot->valid) {
+            free_slot = slot;
+            break;
+        }
+        if (free_slot == NULL || slot->last_used < free_slot->last_used)
+            free_slot = slot;
+    }
+
+    // out of slots rather than space, the old snapshot may sit anywhere
+    if (free_slot->valid) {
+        free_slot->valid = false;
+        if (!gm_dir_cache_fit(length, &offset)) return NULL;
+    }
+
+    free_slot->aram_offset = offset;
+    free_slot->length = length;
+    return free_slot;
+}
+
+// Keeps the current listing, called before the store is rewound
+static void gm_dir_cache_save() {
+    if (!gm_list_complete || gm_entry_count == 0) return;
+
+    const char *path = gm_name_arena;
+    gm_dir_cache_t *old = gm_dir_cache_find(path);
+    if (old != NULL) old->valid = false;
+
+    u32 length = gm_entry_count * sizeof(gm_dir_record_t) + gm_entry_count * sizeof(u16) + gm_name_arena_used;
+    gm_dir_cache_t *snap = gm_dir_cache_alloc(OSRoundUp32B(length));
+    if (snap == NULL) {
+        OSReport("Directory too large to cache (%u bytes)\n", length);
+        return;
+    }
+
     u64 start_time = gettime();
-    qsort(__gm_sorted_path_list, path_count, sizeof(gm_path_entry_t*), &gm_cmp_path_entry);
+    gm_dir_stream_t stream = { .aram_offset = snap->aram_offset, .write = true };
+    gm_dir_stream_copy(&stream, gm_name_arena, gm_name_arena_used);
+    gm_dir_stream_copy(&stream, gm_entry_order, gm_entry_count * sizeof(u16));
+    for (int i = 0; i < gm_entry_count; i++) {
+        gm_file_entry_t *entry = &gm_entry_pool[i];
+        gm_dir_record_t record = {
+            .name = entry->name,
+            .sort_key = entry->sort_key,
+            .type = entry->type,
+            .meta_ready = entry->meta_ready,
+        };
+        memcpy(&record.extra, &entry->extra, sizeof(gm_extra_t));
+        gm_dir_stream_copy(&stream, &record, sizeof(record));
+    }
+    gm_dir_stream_flush(&stream);
+
+    strcpy(snap->path, path);
+    snap->sig = gm_list_sig;
+    snap->entry_count = gm_entry_count;
+    snap->arena_used = gm_name_arena_used;
+    snap->top_line = top_line_num;
+    snap->selected_slot = selected_slot;
+    snap->last_used = ++gm_dir_cache_clock;
+    snap->valid = true;
 
     f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
-    OSReport("Sort took=%f\n", runtime);
+    OSReport("Directory cache save took=%f (%u entries)\n", runtime, gm_entry_count);
     (void)runtime;
 }
-// returns amount of space used in aram
-static int gm_load_banner(gm_file_entry_t *entry, u32 aram_offset, bool force_unload) {
-    if (entry->extra.dvd_bnr_offset == 0) return false;
 
-    __attribute_aligned_data_lowmem__ static BNR banner_buffer;
-    if (bnr_cache_get(entry->extra.game_id, &banner_buffer))
-        goto cached;
+// rebuilds a pool record the way gm_new_entry would have
+static void gm_dir_cache_restore_entry(gm_file_entry_t *entry, gm_dir_record_t *record) {
+    memset(entry, 0, sizeof(gm_file_entry_t));
+    entry->name = record->name;
+    entry->sort_key = record->sort_key;
+    entry->type = record->type;
+    memcpy(&entry->extra, &record->extra, sizeof(gm_extra_t));
 
-    // load the banner
-    dvd_custom_open(entry->path, FILE_ENTRY_TYPE_FILE, IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLESPEEDEMU);
-    file_status_t *status = dvd_custom_status();
-    if (status == NULL || status->result != 0) {
-        OSReport("ERROR: could not open file\n");
-        return false;
+    if (entry->type != GM_FILE_TYPE_GAME) {
+        entry->meta_ready = true;
+        return;
     }
 
-    //__attribute_aligned_data_lowmem__ static BNR banner_buffer;
-    dvd_threaded_read(&banner_buffer, sizeof(BNR), entry->extra.dvd_bnr_offset, status->fd);
-    dvd_custom_close(status->fd);
+    // the sort key came back with the arena, probe again when the catalog lost it
+    entry->asset.use_banner = true;
+    if (record->meta_ready) {
+        char path[128];
+        entry->meta_ready = catalog_lookup(gm_entry_path(entry, path), entry->extra.file_size, entry->extra.file_mtime, NULL);
+    }
+}
 
-    bnr_cache_put(entry->extra.game_id, &banner_buffer);
-    cached:
+// Puts a cached listing back in the store and the grid, false on a miss
+static bool gm_dir_cache_restore(const char *path) {
+    gm_dir_cache_t *snap = gm_dir_cache_find(path);
+    if (snap == NULL) return false;
 
-    entry->asset.banner.state = GM_LOAD_STATE_LOADING;
-    gm_banner_buf_t *banner_ptr = gm_get_banner_buf();
-    if (banner_ptr == NULL) {
-        OSReport("ERROR: could not allocate memory\n");
+    u64 start_time = gettime();
+    gm_dir_stream_t stream = { .aram_offset = snap->aram_offset, .write = false };
+
+    // names first, the records are rebuilt against them
+    gm_dir_stream_copy(&stream, gm_name_arena, snap->arena_used);
+    gm_name_arena_used = snap->arena_used;
+    gm_dir_stream_copy(&stream, gm_entry_order, snap->entry_count * sizeof(u16));
+
+    game_index_init(&gm_disc_index, gm_disc_index_slots, GM_DISC_INDEX_SIZE);
+    for (int i = 0; i < snap->entry_count; i++) {
+        gm_dir_record_t record;
+        gm_dir_stream_copy(&stream, &record, sizeof(record));
+
+        gm_file_entry_t *entry = &gm_entry_pool[i];
+        gm_dir_cache_restore_entry(entry, &record);
+        if (entry->type == GM_FILE_TYPE_GAME) gm_index_disc(entry);
+    }
+
+    gm_list_sig = snap->sig;
+    gm_list_complete = true;
+    snap->last_used = ++gm_dir_cache_clock;
+
+    // back where the user left it, as far as the grid allows
+    int line_total = (snap->entry_count + 7) >> 3;
+    if (line_total < DRAW_TOTAL_ROWS) line_total = DRAW_TOTAL_ROWS;
+    int top_line = snap->top_line;
+    if (top_line > line_total - DRAW_TOTAL_ROWS) top_line = line_total - DRAW_TOTAL_ROWS;
+    if (top_line < 0) top_line = 0;
+    int slot = snap->selected_slot;
+    if (slot >= snap->entry_count) slot = snap->entry_count - 1;
+    if (slot < top_line * 8 || slot >= (top_line + DRAW_TOTAL_ROWS) * 8) slot = top_line * 8;
+
+    BOOL enabled = OSDisableInterrupts();
+    gm_entry_count = snap->entry_count;
+    game_backing_count = gm_entry_count;
+    number_of_lines = line_total;
+    grid_setup_at(top_line, slot);
+    OSRestoreInterrupts(enabled);
+
+    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
+    OSReport("Directory cache restore took=%f (%u entries)\n", runtime, gm_entry_count);
+    (void)runtime;
+    return true;
+}
+
+// readdir only, no headers, true when the listing is unchanged
+static bool gm_dir_cache_revalidate(const char *target_dir) {
+    OSLockMutex(gm_card_mutex);
+    int res = dvd_custom_open(target_dir, FILE_ENTRY_TYPE_DIR, 0);
+    file_status_t *status = res == 0 ? dvd_custom_status() : NULL;
+    if (status == NULL || status->result != 0) {
+        OSUnlockMutex(gm_card_mutex);
         return false;
     }
 
-    memcpy(&banner_ptr->data[0], &banner_buffer.pixelData[0], BNR_PIXELDATA_LEN);
-    DCFlushRange(&banner_ptr->data[0], BNR_PIXELDATA_LEN);
-    entry->asset.banner.buf = banner_ptr;
-    if (force_unload) {
-        gm_banner_setup_unload(&entry->asset.banner, aram_offset);
-    } else {
-        gm_banner_setup(&entry->asset.banner, aram_offset);
+    static GCN_ALIGNED(file_entry_t) ent;
+    uint8_t dir_fd = status->fd;
+    u32 sig = 0;
+    bool complete = false;
+    while (1) {
+        if (gm_enum_yield()) break;
+        if (dvd_custom_readdir(&ent, dir_fd) != 0) break;
+        if (ent.name[0] == 0) {
+            complete = true;
+            break;
+        }
+
+        if (gm_list_filter(target_dir, &ent) == GM_FILE_TYPE_UNKNOWN) continue;
+        sig = gm_list_sig_update(sig, &ent);
     }
 
-    // TODO: check current language using extra.dvd_bnr_type
-    //memcpy(&entry->desc, &banner_buffer.desc[0], sizeof(BNRDesc));
+    dvd_custom_close(dir_fd);
+    OSUnlockMutex(gm_card_mutex);
 
-    return true;
+    // a cancelled pass proves nothing, the snapshot stays as it was
+    if (!complete) return true;
+    return sig == gm_list_sig;
 }
 
 #if 0
@@ -630,7 +1228,7 @@ static int gm_load_banner(gm_file_entry_t *entry, u32 aram_offset, bool force_un
 static bool gm_load_icon(gm_file_entry_t *entry, u32 aram_offset, bool force_unload) {
     // split path and add png extension
     char icon_path[128];
-    strcpy(icon_path, entry->path);
+    gm_entry_path(entry, icon_path);
     char *ext = strrchr(icon_path, '.');
     if (ext == NULL) strcat(icon_path, ".png");
     else strcpy(ext, ".png");
@@ -689,171 +1287,159 @@ static bool gm_load_icon(gm_file_entry_t *entry, u32 aram_offset, bool force_unl
 }
 
 #endif
-void gm_check_files(int path_count) {
-    u64 start_time = gettime();
-
-    for (int i = 0; i < path_count; i++) {
-        gm_path_entry_t *path_entry = __gm_sorted_path_list[i];
-
-        if (!OSTryLockMutex(game_enum_mutex)) {
-            OSReport("STOPPING GAME LOADING\n");
-            break;
-        }
-        OSUnlockMutex(game_enum_mutex);
-
-        // Games
-        if (path_entry->type == GM_FILE_TYPE_GAME) {
-
-            gm_file_entry_t *backing = gm_malloc(sizeof(gm_file_entry_t));
-            memset(backing, 0, sizeof(gm_file_entry_t));
+static void gm_banner_loaded(gm_file_entry_t *entry, gm_banner_buf_t *buf) {
+    entry->asset.banner.buf = buf;
+    entry->asset.banner.state = GM_LOAD_STATE_LOADED;
 
-            strcpy(backing->path, path_entry->path);
-            backing->type = GM_FILE_TYPE_GAME;
-            backing->meta_ready = false;          // metadata not ready yet.
-            backing->asset.use_banner = true;    // default assumption
-
-            // derive fallback name from filename
-            char *base = strrchr(path_entry->path, '/');
-            if (base) {
-                strncpy(backing->desc.fullGameName, base + 1, 
-                        sizeof(backing->desc.fullGameName) - 1);
-            }
+    DCFlushRange(&entry->asset.banner, sizeof(gm_banner_t));
 
-            gm_entry_backing[gm_entry_count] = backing;
-            gm_entry_count++;
-        }
+    // keep the ARAM copy while it is on screen, see gm_banner_release
+    bnr_cache_pin(entry->extra.game_id, entry->extra.disc_num, true);
+}
 
-        // Programs and directories
-        else if (path_entry->type == GM_FILE_TYPE_PROGRAM ||
-                 path_entry->type == GM_FILE_TYPE_DIRECTORY) {
+// only called from the asset loader thread
+static bool gm_banner_texture(gm_file_entry_t *entry) {
+    if (entry->asset.banner.state == GM_LOAD_STATE_LOADED)
+        return true;
 
-            gm_file_entry_t *backing = gm_malloc(sizeof(gm_file_entry_t));
-            memset(backing, 0, sizeof(gm_file_entry_t));
+    if (!entry->meta_ready)
+        return false;
 
-            strcpy(backing->path, path_entry->path);
-            backing->type = path_entry->type;
-            backing->meta_ready = true; // no validation needed
+    if (entry->extra.dvd_bnr_offset == 0)
+        return false;
 
-            char *base = strrchr(path_entry->path, '/');
-            if (base) {
-                strcpy(backing->desc.fullGameName, base + 1);
-            }
+    gm_banner_buf_t *buf = gm_get_banner_buf();
+    if (!buf) {
+        return false;
+    }
 
-            if (path_entry->type == GM_FILE_TYPE_PROGRAM) {
-                strcpy(backing->desc.description, "Homebrew Program");
-            } else {
-                strcpy(backing->desc.description, "Directory");
-            }
+    // the metadata probe already left the pixels in ARAM
+    if (!bnr_cache_get_pixels(entry->extra.game_id, entry->extra.disc_num, buf->data)) {
+        // the catalog skipped the probe, read the banner once and keep it
+        __attribute_aligned_data_lowmem__ static BNR bnr;
 
-            backing->asset.use_banner = false;
+        char path[128];
+        OSLockMutex(gm_card_mutex);
+        dvd_custom_open(gm_entry_path(entry, path), FILE_ENTRY_TYPE_FILE,
+                        IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_DISABLESPEEDEMU);
 
-            gm_entry_backing[gm_entry_count] = backing;
-            gm_entry_count++;
+        file_status_t *status = dvd_custom_status();
+        if (!status || status->result != 0) {
+            dvd_custom_close(status ? status->fd : 0);
+            OSUnlockMutex(gm_card_mutex);
+            gm_free_banner_buf(buf);
+            return false;
         }
 
-        game_backing_count = gm_entry_count;
-    }
+        dvd_threaded_read(&bnr, sizeof(BNR),
+                          entry->extra.dvd_bnr_offset,
+                          status->fd);
 
-    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0f;
-    OSReport("gm_check_files completed: %d entries, %f ms\n",
-             gm_entry_count, runtime);
-}
+        dvd_custom_close(status->fd);
 
-static inline bool gm_entry_is_visible(int index) {
-    int line = index / ASSETS_PER_LINE;
+        // the cache is only changed under the card mutex, the enum thread fills it too
+        bnr_cache_put(entry->extra.game_id, entry->extra.disc_num, &bnr);
+        OSUnlockMutex(gm_card_mutex);
 
-    int first = top_line_num - PRELOAD_LINE_COUNT;
-    int last  = top_line_num + DRAW_TOTAL_ROWS + PRELOAD_LINE_COUNT - 1;
+        memcpy(buf->data, bnr.pixelData, BNR_PIXELDATA_LEN);
+        memcpy(&buf->desc, &bnr.desc[0], sizeof(BNRDesc));
+        DCFlushRange(buf, sizeof(gm_banner_buf_t));
+    }
 
-    return (line >= first && line <= last);
+    gm_banner_loaded(entry, buf);
+    return true;
 }
 
-
-bool gm_banner_texture(int index, gm_file_entry_t *entry) {
+// a banner that is already in ARAM joins the line batch instead of loading
+// on its own, false when it has to come from the card
+static bool gm_banner_queue(gm_file_entry_t *entry, arq_batch_t *batch) {
     if (entry->asset.banner.state == GM_LOAD_STATE_LOADED)
         return true;
 
-    if (!entry)
-        return false;
-    
-    if (!gm_entry_is_visible(index))
-        return false;
-
-    if (!entry || !entry->meta_ready)
-        return false;
+    if (!entry->meta_ready || entry->extra.dvd_bnr_offset == 0)
+        return true; // nothing to show yet
 
-    if (entry->extra.dvd_bnr_offset == 0)
+    u32 aram_offset;
+    if (!bnr_cache_pixels_at(entry->extra.game_id, entry->extra.disc_num, &aram_offset))
         return false;
 
-    static BNR bnr;
+    gm_banner_buf_t *buf = gm_get_banner_buf();
+    if (!buf)
+        return true; // retried with the next request
 
-    dvd_custom_open(entry->path, FILE_ENTRY_TYPE_FILE,
-                    IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLESPEEDEMU);
+    entry->asset.banner.buf = buf;
+    entry->asset.banner.state = GM_LOAD_STATE_LOADING;
+    arq_batch_add(batch, ARAM_DIR_ARAM_TO_MRAM, buf->data, aram_offset, BNR_PIXELS_DESC_LEN, entry);
+    return true;
+}
 
-    file_status_t *status = dvd_custom_status();
-    if (!status || status->result != 0) {
-        dvd_custom_close(status ? status->fd : 0);
-        return false;
+static void gm_banner_queued_done(gm_file_entry_t *entry) {
+    gm_banner_buf_t *buf = entry->asset.banner.buf;
+    if (bnr_cache_pixels_loaded(entry->extra.game_id, entry->extra.disc_num, buf->data)) {
+        gm_banner_loaded(entry, buf);
+        return;
     }
 
-    dvd_threaded_read(&bnr, sizeof(BNR),
-                      entry->extra.dvd_bnr_offset,
-                      status->fd);
-
-    dvd_custom_close(status->fd);
-
-    // Copy metadata
-    memcpy(&entry->desc, &bnr.desc[0], sizeof(BNRDesc));
-
-    gm_banner_buf_t *buf = gm_get_banner_buf();
-    
-    if (!buf) {
-        return false;
-    }
+    // the ARAM copy went stale or was evicted meanwhile, take the slow path
+    gm_free_banner_buf(buf);
+    entry->asset.banner.buf = NULL;
+    entry->asset.banner.state = GM_LOAD_STATE_UNLOADED;
+    gm_banner_texture(entry);
+}
 
-    memcpy(buf->data, bnr.pixelData, BNR_PIXELDATA_LEN);
-    DCFlushRange(buf->data, BNR_PIXELDATA_LEN);
 
-    entry->asset.banner.buf = buf;
-    entry->asset.banner.state = GM_LOAD_STATE_LOADED;
 
-    DCFlushRange(&entry->asset.banner, sizeof(gm_banner_t));
+// keep_pixels pushes the banner into the ARAM store on the same read,
+// so the loader never has to open the image again. desc gets the banner
+// description (the file name without one), it only has to outlive the call.
+static bool gm_parse_banner_meta(gm_file_entry_t *entry, char *path, bool keep_pixels, BNRDesc *desc) {
+    // derive fallback name from filename
+    char *base = strrchr(path, '/');
+    memset(desc, 0, sizeof(BNRDesc));
+    strncpy(desc->fullGameName, base ? base + 1 : path, sizeof(desc->fullGameName) - 1);
 
-    return true;
-}
+    if (entry->meta_ready) return true;
 
+    // headers that were not resolved while listing need the full probe
+    bool prefetched = entry->extra.dvd_bnr_offset != 0;
+    if (!prefetched) {
+        dolphin_game_into_t info = get_game_info(path);
+        if (!info.valid) return false;
+        gm_fill_extra(&entry->extra, &info);
+    }
 
-bool gm_parse_banner_meta(gm_file_entry_t *entry) {
-    if (entry->meta_ready) return true;
+    // the header read may have been long, the entry is probed again later
+    if (gm_enum_cancelled()) return false;
 
-    dolphin_game_into_t info = get_game_info(entry->path);
-    if (!info.valid) return false;
-
-    entry->extra.game_id[0] = info.game_id[0];
-    memcpy(entry->extra.game_id, info.game_id, sizeof(entry->extra.game_id));
-    entry->extra.disc_num = info.disc_num;
-    entry->extra.disc_ver = info.disc_ver;
-    entry->extra.dvd_bnr_offset = info.bnr_offset;
-    entry->extra.dvd_bnr_type = info.bnr_type;
-    entry->extra.dvd_dol_offset = info.dol_offset;
-    entry->extra.dvd_fst_offset = info.fst_offset;
-    entry->extra.dvd_fst_size = info.fst_size;
-    entry->extra.dvd_max_fst_size = info.max_fst_size;
-
-    // Read ONLY the BNR header and desc, no banner load..
+    // one banner read for the metadata and the pixels
+    bool probed = true;
     if (entry->extra.dvd_bnr_offset != 0) {
-        BNR bnr;
-        dvd_custom_open(entry->path, FILE_ENTRY_TYPE_FILE,
-                        IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLESPEEDEMU);
+        __attribute_aligned_data_lowmem__ static BNR bnr; // callers hold the card mutex
+        dvd_custom_open(path, FILE_ENTRY_TYPE_FILE,
+                        IPC_FILE_FLAG_DISABLECACHE | IPC_FILE_FLAG_DISABLEFASTSEEK | IPC_FILE_FLAG_DISABLESPEEDEMU);
         file_status_t *status = dvd_custom_status();
         if (status && status->result == 0) {
             dvd_threaded_read(&bnr, sizeof(BNR), entry->extra.dvd_bnr_offset, status->fd);
             dvd_custom_close(status->fd);
 
-            memcpy(&entry->desc, &bnr.desc[0], sizeof(BNRDesc));
+            // the prefetched offset skipped the magic check, do it here
+            u32 magic = *(u32*)&bnr.magic[0];
+            if (magic != BANNER_MAGIC_1 && magic != BANNER_MAGIC_2) {
+                if (!prefetched) return false;
+                entry->extra.dvd_bnr_offset = 0;
+                return gm_parse_banner_meta(entry, path, keep_pixels, desc);
+            }
+            entry->extra.dvd_bnr_type = magic == BANNER_MAGIC_2; // BANNER_MULTI_LANG
+
+            memcpy(desc, &bnr.desc[0], sizeof(BNRDesc));
+            if (keep_pixels) bnr_cache_put(entry->extra.game_id, entry->extra.disc_num, &bnr);
+        } else {
+            probed = false;
         }
     }
 
+    if (probed) catalog_update(path, &entry->extra, desc);
+
     entry->meta_ready = true;
     return true;
 }
@@ -994,90 +1580,311 @@ void gm_check_files(int path_count) {
     (void)runtime;
 }
 */
-void gm_line_load(int line_num) {
-    // OSReport("Line load %d\n", line_num);
+// Titles can move entries around while this runs, so it walks pool slots
+// rather than the sorted order. Returns the number of entries that moved.
+static int gm_parse_meta_slots(const u16 *slots, int count) {
+    int moved = 0;
+    for (int i = 0; i < count; i++) {
+        if (gm_enum_yield()) {
+            OSReport("STOPPING GAME LOADING\n");
+            break;
+        }
+
+        gm_file_entry_t *e = &gm_entry_pool[slots ? slots[i] : i];
+        if (e->type != GM_FILE_TYPE_GAME || e->meta_ready) continue;
+
+        char path[128];
+        gm_entry_path(e, path);
+
+        BNRDesc desc;
+        OSLockMutex(gm_card_mutex);
+        bool valid = gm_parse_banner_meta(e, path, true, &desc);
+        OSUnlockMutex(gm_card_mutex);
+
+        if (valid) {
+            gm_index_disc(e);
+            moved += gm_resort_entry(e, &desc);
+        }
+    }
+
+    return moved;
+}
+
+_Static_assert(ASSETS_PER_LINE <= ARQ_BATCH_MAX);
 
+// returns false when some entry could not be loaded yet (metadata pending)
+// Everything already in ARAM goes out as one batch, the banners that need
+// the card are read while it runs.
+static bool gm_line_load(int line_num) {
+    static arq_batch_t batch;
+    arq_batch_init(&batch, make_type('I', 'X', 'X', 'L'), ARQ_PRIORITY_LOW);
+
+    gm_file_entry_t *from_card[ASSETS_PER_LINE];
+    int from_card_count = 0;
+
+    bool complete = true;
     for (int i = 0; i < ASSETS_PER_LINE; i++) {
         int index = (line_num * ASSETS_PER_LINE) + i;
         if (index >= gm_entry_count) break;
 
-        gm_file_entry_t *entry = gm_entry_backing[index];
+        gm_file_entry_t *entry = gm_entry_at(index);
+        if (entry->type == GM_FILE_TYPE_GAME) {
+            if (!entry->meta_ready) complete = false;
+            if (!gm_banner_queue(entry, &batch)) from_card[from_card_count++] = entry;
+        } else {
+            gm_icon_load(&entry->asset.icon, &batch, entry);
+        }
+    }
+
+    arq_batch_submit(&batch, NULL);
+    for (int i = 0; i < from_card_count; i++) {
+        gm_banner_texture(from_card[i]);
+    }
+    arq_batch_wait(&batch);
+
+    for (u32 i = 0; i < batch.count; i++) {
+        gm_file_entry_t *entry = batch.transfers[i].tag;
         if (entry->type == GM_FILE_TYPE_GAME) {
-            //gm_icon_load(&entry->asset.icon);
-            gm_banner_texture(index, entry);
+            gm_banner_queued_done(entry);
         } else {
-            gm_icon_load(&entry->asset.icon);
+            entry->asset.icon.state = GM_LOAD_STATE_LOADED;
+            DCFlushRange(&entry->asset.icon, sizeof(gm_icon_t));
         }
     }
+
+    return complete;
 }
 
-void gm_line_free(int line_num) {
+static void gm_line_free(int line_num) {
     // OSReport("Line free %d\n", line_num);
 
     for (int i = 0; i < ASSETS_PER_LINE; i++) {
         int index = (line_num * ASSETS_PER_LINE) + i;
         if (index >= gm_entry_count) break;
 
-        gm_file_entry_t *entry = gm_entry_backing[index];
+        gm_file_entry_t *entry = gm_entry_at(index);
         if (entry->type == GM_FILE_TYPE_GAME) {
             // OSReport("Freeing assets %s\n", entry->path);
             gm_icon_free(&entry->asset.icon);
-            gm_banner_free(&entry->asset.banner);
+            gm_banner_release(entry);
         } else {
             gm_icon_free(&entry->asset.icon);
         }
     }
 }
 
-void gm_line_changed(int delta) {
-    // OSReport("Line changed %+d\n", delta);
+// Asset loader
+// Banners are read on a dedicated thread so the menu never waits on the card.
+// The menu only posts the new top line and scroll direction, the loader turns
+// that into a queue ordered by priority: the visible lines, then the preload
+// lines in the direction of travel, then the ones behind. A newer request
+// drops whatever is left of the old queue, lines that scrolled out of the
+// window are freed.
+#define GM_ASSET_MAX_LINES GM_MAX_LINES
+#define GM_ASSET_WINDOW (DRAW_TOTAL_ROWS + (PRELOAD_LINE_COUNT * 2))
+
+__attribute_aligned_data_lowmem__ static u8 gm_asset_thread_stack[16 * 1024];
+static OSThread gm_asset_thread_obj;
+static OSThreadQueue gm_asset_wait_queue;
+
+static u8 gm_asset_line_loaded[GM_ASSET_MAX_LINES];
+static int gm_asset_queue[GM_ASSET_WINDOW];
+static int gm_asset_queue_len = 0;
+
+// written by the menu, read by the loader with interrupts off
+static volatile u32 gm_asset_generation = 0;
+static volatile int gm_asset_top_line = 0;
+static volatile int gm_asset_direction = 0;
+static volatile bool gm_asset_stopping = false;
+static bool gm_asset_running = false;
+
+// the loader's own view, for gm_asset_evict
+static int gm_asset_loader_top = 0;
+static int gm_asset_loading_line = -1;
+
+static bool gm_asset_in_window(int line_num, int top_line) {
+    return line_num >= top_line - PRELOAD_LINE_COUNT && line_num < top_line + DRAW_TOTAL_ROWS + PRELOAD_LINE_COUNT;
+}
+
+static void gm_asset_queue_push(int line_num) {
+    if (line_num < 0 || line_num >= number_of_lines || line_num >= GM_ASSET_MAX_LINES) return;
+    if (gm_asset_line_loaded[line_num]) return;
+    gm_asset_queue[gm_asset_queue_len++] = line_num;
+}
+
+static void gm_asset_queue_build(int top_line, int direction) {
+    gm_asset_queue_len = 0;
+
+    for (int i = 0; i < DRAW_TOTAL_ROWS; i++) {
+        gm_asset_queue_push(top_line + i);
+    }
+
+    int ahead = direction < 0 ? top_line - 1 : top_line + DRAW_TOTAL_ROWS;
+    int behind = direction < 0 ? top_line + DRAW_TOTAL_ROWS : top_line - 1;
+    int step = direction < 0 ? -1 : 1;
+    for (int i = 0; i < PRELOAD_LINE_COUNT; i++) {
+        gm_asset_queue_push(ahead + (i * step));
+    }
+    for (int i = 0; i < PRELOAD_LINE_COUNT; i++) {
+        gm_asset_queue_push(behind - (i * step));
+    }
+}
+
+// every line, entries may have been moved into a line after it was loaded
+static bool gm_line_holds_buffers(int line_num) {
+    for (int i = 0; i < ASSETS_PER_LINE; i++) {
+        int index = (line_num * ASSETS_PER_LINE) + i;
+        if (index >= gm_entry_count) break;
 
-    // int previous_line_num = top_line_num;
-    int new_line_num = top_line_num + delta;
+        gm_file_entry_t *entry = gm_entry_at(index);
+        if (entry->asset.icon.buf != NULL || entry->asset.banner.buf != NULL) return true;
+    }
 
-    // two slots should be processed, one to load and one to unload
+    return false;
+}
 
-    // get number of lines to process
-    if (delta < 0) {
-        int load_line = new_line_num - PRELOAD_LINE_COUNT + 1;
-        if (load_line >= 0) {
-            // load
-            // OSReport("DEBUG: Load line %d\n", load_line);
-            //gm_line_load(load_line);
+// Frees the line farthest from the screen to make room, never a visible
+// line or the one being loaded. Only the loader owns the buffers.
+static bool gm_asset_evict() {
+    if (OSGetCurrentThread() != &gm_asset_thread_obj) return false;
+
+    int top_line = gm_asset_loader_top;
+    int victim = -1;
+    int victim_distance = 0;
+    for (int line_num = 0; line_num < number_of_lines && line_num < GM_ASSET_MAX_LINES; line_num++) {
+        if (line_num >= top_line && line_num < top_line + DRAW_TOTAL_ROWS) continue;
+        if (line_num == gm_asset_loading_line) continue;
+
+        int distance = line_num < top_line ? top_line - line_num : line_num - (top_line + DRAW_TOTAL_ROWS - 1);
+        if (distance > victim_distance && gm_line_holds_buffers(line_num)) {
+            victim = line_num;
+            victim_distance = distance;
         }
+    }
+
+    if (victim < 0) return false;
+
+    OSReport("Evicting line %d for buffers\n", victim);
+    gm_line_free(victim);
+    gm_asset_line_loaded[victim] = false;
+    return true;
+}
+
+static void gm_asset_free_outside(int top_line) {
+    for (int line_num = 0; line_num < number_of_lines && line_num < GM_ASSET_MAX_LINES; line_num++) {
+        if (gm_asset_in_window(line_num, top_line)) continue;
+
+        gm_line_free(line_num);
+        gm_asset_line_loaded[line_num] = false;
+    }
+}
 
-        // unload from the bottom
-        int unload_line = new_line_num + DRAW_TOTAL_ROWS + PRELOAD_LINE_COUNT;
-        if (unload_line < number_of_lines) {
-            // unload
-            // OSReport("DEBUG: Unload line %d\n", unload_line);
-            //gm_line_free(unload_line);
+static void *gm_asset_worker(void *param) {
+    u32 generation = ~gm_asset_generation;
+    int top_line = 0;
+
+    while (1) {
+        BOOL enabled = OSDisableInterrupts();
+        while (!gm_asset_stopping && generation == gm_asset_generation && gm_asset_queue_len == 0) {
+            dolphin_OSSleepThread(&gm_asset_wait_queue);
         }
-    } else if (delta > 0) {
-        int load_line = new_line_num + DRAW_TOTAL_ROWS + PRELOAD_LINE_COUNT - 1;
-        if (load_line < number_of_lines) {
-            // load
-            // OSReport("DEBUG: Load line %d\n", load_line);
-            //gm_line_load(load_line);
+        bool stopping = gm_asset_stopping;
+        bool changed = generation != gm_asset_generation;
+        generation = gm_asset_generation;
+        top_line = gm_asset_top_line;
+        int direction = gm_asset_direction;
+        OSRestoreInterrupts(enabled);
+        gm_asset_loader_top = top_line;
+
+        if (stopping) break;
+
+        if (changed) {
+            gm_asset_free_outside(top_line);
+            gm_asset_queue_build(top_line, direction);
         }
 
-        // unload from the top
-        int unload_line = new_line_num - PRELOAD_LINE_COUNT;
-        if (unload_line >= 0) {
-            // unload
-            // OSReport("DEBUG: Unload line %d\n", unload_line);
-            //gm_line_free(unload_line);
+        if (gm_asset_queue_len == 0) continue;
+
+        // one line at a time, a newer request rebuilds the queue in between
+        int line_num = gm_asset_queue[0];
+        gm_asset_queue_len--;
+        memmove(&gm_asset_queue[0], &gm_asset_queue[1], gm_asset_queue_len * sizeof(int));
+
+        trace_begin(TRACE_ENUM_LINES);
+        gm_asset_loading_line = line_num;
+        bool complete = gm_line_load(line_num);
+        gm_asset_loading_line = -1;
+
+        // a reorder while loading means the line may hold other entries now
+        enabled = OSDisableInterrupts();
+        if (complete && generation == gm_asset_generation) {
+            gm_asset_line_loaded[line_num] = true;
         }
+        OSRestoreInterrupts(enabled);
+        trace_end(TRACE_ENUM_LINES, line_num);
+
+        if (gm_asset_queue_len == 0) gm_pool_trace();
+    }
+
+    return NULL;
+}
+
+static void gm_asset_request(int top_line, int direction) {
+    BOOL enabled = OSDisableInterrupts();
+    gm_asset_top_line = top_line;
+    gm_asset_direction = direction;
+    gm_asset_generation++;
+    if (gm_asset_running) {
+        dolphin_OSWakeupThread(&gm_asset_wait_queue);
     }
+    OSRestoreInterrupts(enabled);
+}
+
+// the sort order changed under the grid, every line has to be checked again
+static void gm_asset_reordered() {
+    BOOL enabled = OSDisableInterrupts();
+    memset(gm_asset_line_loaded, 0, sizeof(gm_asset_line_loaded));
+    gm_asset_generation++;
+    if (gm_asset_running) {
+        dolphin_OSWakeupThread(&gm_asset_wait_queue);
+    }
+    OSRestoreInterrupts(enabled);
+}
 
-    // int icon_buf_count = gm_count_icon_buf();
-    // int banner_buf_count = gm_count_banner_buf();
+static void gm_asset_start() {
+    if (gm_asset_running) return;
+
+    memset(gm_asset_line_loaded, 0, sizeof(gm_asset_line_loaded));
+    gm_asset_queue_len = 0;
+    gm_asset_stopping = false;
+    OSInitThreadQueue(&gm_asset_wait_queue);
+    gm_asset_running = true;
+
+    u32 stack_size = sizeof(gm_asset_thread_stack);
+    void *stack_top = gm_asset_thread_stack + stack_size;
+    s32 priority = DEFAULT_THREAD_PRIO + 2; // visible banners go before the enum thread
+
+    dolphin_OSCreateThread(&gm_asset_thread_obj, gm_asset_worker, NULL, stack_top, stack_size, priority, 0);
+    dolphin_OSResumeThread(&gm_asset_thread_obj);
+}
+
+static void gm_asset_stop() {
+    if (!gm_asset_running) return;
+
+    BOOL enabled = OSDisableInterrupts();
+    gm_asset_stopping = true;
+    dolphin_OSWakeupThread(&gm_asset_wait_queue);
+    OSRestoreInterrupts(enabled);
+
+    gm_join_thread(&gm_asset_thread_obj, "asset");
+    gm_asset_running = false;
+}
 
-    // OSReport("icon buf count = %d\n", icon_buf_count);
-    // OSReport("banner buf count = %d\n", banner_buf_count);
+void gm_line_changed(int delta) {
+    // OSReport("Line changed %+d\n", delta);
 
-    // int pending_free = gm_count_pending_free();
-    // OSReport("pending free = %d\n", pending_free);
+    // called before top_line_num moves, this only posts a request
+    gm_asset_request(top_line_num + delta, delta);
 }
 
 // so grid can check if load/unload is possible
@@ -1094,8 +1901,8 @@ void gm_debug_func() {
     OSReport("banner buf count = %d\n", banner_buf_count);
 
     for (int i = 0; i < gm_entry_count; i++) {
-        gm_file_entry_t *entry = gm_entry_backing[i];
-        OSReport("Entry %d: %s\n", i, entry->path);
+        gm_file_entry_t *entry = gm_entry_at(i);
+        OSReport("Entry %d: %s\n", i, gm_entry_name(entry));
 
         if (entry->type == GM_FILE_TYPE_GAME) {
             // banner buf
@@ -1105,16 +1912,210 @@ void gm_debug_func() {
 }
 #endif
 
-void gm_setup_grid(int line_count, bool initial) {
-    number_of_lines = (line_count + 7) >> 3;
-    if (number_of_lines < 4) {
-        number_of_lines = 4;
+
+// Background crawler
+// Walks the rest of the card at low priority once the visible directory is done,
+// probing new or changed games into the catalog. The walk resumes where it was
+// stopped the next time a directory finishes loading.
+#define GM_CRAWL_MAX_DEPTH 64
+#define GM_CRAWL_BATCH 32
+#define GM_CRAWL_SAVE_EVERY 32
+
+typedef struct {
+    char path[128];
+    bool files_only; // revisit after a full batch, subdirectories were already queued
+    u32 resume; // listing position a revisit starts probing from
+} gm_crawl_dir_t;
+
+typedef struct {
+    char path[128];
+    gm_extra_t extra;
+    u32 index; // listing position
+} gm_crawl_item_t;
+
+__attribute_data_lowmem__ static gm_crawl_dir_t gm_crawl_stack[GM_CRAWL_MAX_DEPTH];
+__attribute_data_lowmem__ static gm_crawl_item_t gm_crawl_batch[GM_CRAWL_BATCH];
+__attribute_aligned_data_lowmem__ static u8 gm_crawl_thread_stack[16 * 1024];
+
+static OSThread gm_crawl_thread_obj;
+static int gm_crawl_depth = 0;
+static int gm_crawl_unsaved = 0;
+static bool gm_crawl_seeded = false;
+static bool gm_crawl_done = false;
+static bool gm_crawl_running = false;
+
+static void gm_crawl_push(const char *path, bool files_only, u32 resume) {
+    if (gm_crawl_depth >= GM_CRAWL_MAX_DEPTH) {
+        OSReport("WARNING: crawl too deep, skipping %s\n", path);
+        return;
     }
 
-    if (initial) {
-        // Setup the grid
-        grid_setup_func();
+    gm_crawl_dir_t *dir = &gm_crawl_stack[gm_crawl_depth++];
+    strcpy(dir->path, path);
+    dir->files_only = files_only;
+    dir->resume = resume;
+}
+
+// lists one directory, then probes the games the catalog does not know yet
+// returns true when the directory has to be visited again, from dir->resume on.
+// Games that fail to probe never reach the catalog, so a revisit has to move
+// past them instead of picking them up again.
+static bool gm_crawl_dir(gm_crawl_dir_t *dir, int *probed) {
+    OSLockMutex(gm_card_mutex);
+    if (dvd_custom_open(dir->path, FILE_ENTRY_TYPE_DIR, 0) != 0) {
+        OSUnlockMutex(gm_card_mutex);
+        return false; // gone since it was queued
+    }
+
+    file_status_t *status = dvd_custom_status();
+    if (status->result != 0) {
+        dvd_custom_close(status->fd);
+        OSUnlockMutex(gm_card_mutex);
+        return false;
+    }
+
+    uint8_t dir_fd = status->fd;
+    static GCN_ALIGNED(file_entry_t) ent;
+    int batch_count = 0;
+    int depth = gm_crawl_depth;
+    bool revisit = false;
+    u32 index = 0;
+    u32 resume = 0;
+
+    while (1) {
+        // stopped half way, forget the subdirectories and come back later
+        if (gm_enum_yield()) {
+            dvd_custom_close(dir_fd);
+            OSUnlockMutex(gm_card_mutex);
+            gm_crawl_depth = depth;
+            gm_crawl_push(dir->path, dir->files_only, dir->resume);
+            return false;
+        }
+
+        // names only, most files are catalog hits and their headers are not needed
+        if (dvd_custom_readdir(&ent, dir_fd) != 0) break;
+        if (ent.name[0] == 0) break; // end of directory
+        if (index++ < dir->resume) continue;
+        if (ent.attrib & FILE_ATTRIB_FLAG_HIDDEN) continue;
+        if (check_file_hidden(ent.name)) continue;
+
+        char path[128];
+        if (strlen(dir->path) + strlen(ent.name) + 2 > sizeof(path)) continue;
+        strcpy(path, dir->path);
+        strcat(path, ent.name);
+
+        if (ent.type == FILE_ENTRY_TYPE_DIR) {
+            if (!dir->files_only) {
+                strcat(path, "/");
+                gm_crawl_push(path, false, 0);
+            }
+            continue;
+        }
+
+        if (gm_get_file_type(ent.name) != GM_FILE_TYPE_GAME) continue;
+
+        u32 file_mtime = (ent.date << 16) | ent.time;
+        if (catalog_lookup(path, (u32)ent.size, file_mtime, NULL)) continue;
+
+        if (batch_count == GM_CRAWL_BATCH) {
+            if (!revisit) resume = index - 1;
+            revisit = true;
+            continue;
+        }
+
+        gm_crawl_item_t *item = &gm_crawl_batch[batch_count++];
+        item->index = index - 1;
+        strcpy(item->path, path);
+        memset(&item->extra, 0, sizeof(gm_extra_t));
+        item->extra.file_size = (u32)ent.size;
+        item->extra.file_mtime = file_mtime;
+    }
+
+    dvd_custom_close(dir_fd);
+    OSUnlockMutex(gm_card_mutex);
+
+    // the listing has to be closed first, the emulated card has a single handle.
+    // Only the misses are opened, the probe reads their header (get_game_info).
+    static gm_file_entry_t probe;
+    static BNRDesc probe_desc;
+    for (int i = 0; i < batch_count; i++) {
+        if (gm_enum_yield()) {
+            dir->resume = gm_crawl_batch[i].index;
+            return true;
+        }
+
+        char *path = gm_crawl_batch[i].path;
+        memset(&probe, 0, sizeof(gm_file_entry_t));
+        memcpy(&probe.extra, &gm_crawl_batch[i].extra, sizeof(gm_extra_t));
+        probe.type = GM_FILE_TYPE_GAME;
+
+        OSLockMutex(gm_card_mutex);
+        gm_parse_banner_meta(&probe, path, false, &probe_desc); // other directories, metadata only
+        OSUnlockMutex(gm_card_mutex);
+        (*probed)++;
+    }
+
+    dir->resume = resume;
+    return revisit;
+}
+
+static void *gm_crawl_worker(void *param) {
+    if (!gm_crawl_seeded) {
+        gm_crawl_seeded = true;
+        gm_crawl_depth = 0;
+        gm_crawl_push("/", false, 0);
+    }
+
+    while (gm_crawl_depth > 0) {
+        if (gm_enum_cancelled()) break;
+
+        gm_crawl_dir_t dir = gm_crawl_stack[--gm_crawl_depth];
+
+        trace_begin(TRACE_CRAWL_DIR);
+        int probed = 0;
+        if (gm_crawl_dir(&dir, &probed)) {
+            gm_crawl_push(dir.path, true, dir.resume);
+        }
+        trace_end(TRACE_CRAWL_DIR, probed);
+
+        gm_crawl_unsaved += probed;
+        if (gm_crawl_unsaved >= GM_CRAWL_SAVE_EVERY) {
+            gm_crawl_unsaved = 0;
+            catalog_save();
+        }
+
+        // let the menu have the card between directories
+        gm_enum_yield();
+    }
+
+    if (gm_crawl_depth == 0) {
+        OSReport("Crawl complete\n");
+        gm_crawl_done = true;
+        catalog_save();
     }
+
+    return NULL;
+}
+
+static void gm_crawl_start() {
+    if (gm_crawl_done || gm_crawl_running) return;
+
+    gm_crawl_running = true;
+    u32 stack_size = sizeof(gm_crawl_thread_stack);
+    void *stack_top = gm_crawl_thread_stack + stack_size;
+    s32 priority = DEFAULT_THREAD_PRIO + 8; // below the enum thread and the menu
+
+    dolphin_OSCreateThread(&gm_crawl_thread_obj, gm_crawl_worker, NULL, stack_top, stack_size, priority, 0);
+    dolphin_OSResumeThread(&gm_crawl_thread_obj);
+}
+
+static void gm_crawl_stop() {
+    if (!gm_crawl_running) return;
+
+    gm_cancel_requested = true;
+    gm_join_thread(&gm_crawl_thread_obj, "crawl");
+    gm_cancel_requested = false;
+    gm_crawl_running = false;
 }
 
 void *gm_thread_worker(void* param) {
@@ -1124,67 +2125,83 @@ void *gm_thread_worker(void* param) {
         return NULL;
     }
 
-    static bool fill_cache = true;
-    if (fill_cache) {
-        fill_cache = false;
-        
-        char path_stack[100][128];
-        int path_count = 1;
-        strcpy(path_stack[0], "/");
-
-        while (path_count > 0) {
-            char* cur = path_stack[--path_count];
-            gm_list_info list_info = gm_list_files(cur);
-            gm_sort_files(list_info.num_paths);
-            gm_check_files(list_info.num_paths);
-            if (gm_entry_count > 0) {
-                for (int i = 0; i < gm_entry_count; i++) {
-                    gm_file_entry_t *entry = gm_entry_backing[i];
-                    if (entry->type == GM_FILE_TYPE_GAME) {
-                        gm_icon_free(&entry->asset.icon);
-                        gm_banner_free(&entry->asset.banner);
-                    } else {
-                        gm_icon_free(&entry->asset.icon);
-                    }
-                    gm_free(entry);
-                }
-                gm_entry_count = 0;
-            }
-
-            for (int i = 0; i < list_info.num_paths; i++) {
-                gm_path_entry_t* entry = __gm_sorted_path_list[i];
+    trace_begin(TRACE_ENUM);
+    catalog_load();
+    bnr_cache_init(); // before the asset loader, it takes back what a soft reset left in ARAM
 
-                if (entry->type == GM_FILE_TYPE_DIRECTORY) {
-                    char subdir_path[128];
-                    strcpy(subdir_path, entry->path);
-                    strcat(subdir_path, "/");
+    // a restored listing is already on screen, check it is still current
+    if (gm_dir_restored) {
+        gm_asset_start();
+        gm_asset_request(top_line_num, 0);
 
-                    if (path_count < 100) {
-                        strcpy(path_stack[path_count++], subdir_path);
-                    }
-                }
-            }
+        if (!gm_dir_cache_revalidate(target)) {
+            OSReport("Directory changed, listing again\n");
+            gm_asset_stop();
+            gm_reset_entries();
+            gm_dir_restored = false;
         }
     }
 
-    gm_list_info list_info = gm_list_files(target);
-    gm_setup_grid(list_info.num_paths, true);
-    gm_sort_files(list_info.num_paths);
-    gm_check_files(list_info.num_paths);
-
-    for (int i = 0; i < gm_entry_count; i++) {
-        gm_file_entry_t *e = gm_entry_backing[i];
-        if (e->type == GM_FILE_TYPE_GAME) {
-            gm_parse_banner_meta(e);
-        }
+    // entries show up on the grid while the directory is read
+    if (!gm_dir_restored) {
+        gm_setup_grid(0, true);
+        gm_list_files(target);
     }
 
-    gm_setup_grid(gm_entry_count, false);
-    // one temporary line load...
-    for (int line = 0; line < DRAW_TOTAL_ROWS + PRELOAD_LINE_COUNT; line++) {
-        gm_line_load(line);
+    // the screen the user is looking at first, then everything else
+    static u16 first_screen[ASSETS_INITIAL_COUNT];
+    int first_index = top_line_num * ASSETS_PER_LINE;
+    int first_count = 0;
+    for (int i = first_index; i < gm_entry_count && first_count < ASSETS_INITIAL_COUNT; i++) {
+        first_screen[first_count++] = gm_entry_order[i];
     }
 
+    trace_begin(TRACE_ENUM_META);
+    gm_parse_meta_slots(first_screen, first_count);
+    trace_end(TRACE_ENUM_META, first_count);
+
+    // banners stream in from here on, following the grid
+    gm_asset_start();
+    gm_asset_request(top_line_num, 0);
+
+    // in batches, so titles that move entries do not restart the loader each time
+    trace_begin(TRACE_ENUM_META);
+    int total = gm_entry_count;
+    for (int start = 0; start < total; start += ASSETS_PER_PAGE) {
+        int count = total - start < ASSETS_PER_PAGE ? total - start : ASSETS_PER_PAGE;
+        static u16 batch[ASSETS_PER_PAGE];
+        for (int i = 0; i < count; i++) batch[i] = start + i;
+
+        if (gm_parse_meta_slots(batch, count) > 0) {
+            gm_asset_reordered();
+        }
+        if (gm_enum_cancelled()) break;
+    }
+    trace_end(TRACE_ENUM_META, gm_entry_count);
+    trace_end(TRACE_ENUM, gm_entry_count);
+
+    // lines skipped while their metadata was pending get another pass
+    gm_asset_reordered();
+
+    // only writes when something was probed, and not at all once we are being stopped
+    catalog_save();
+
+    // idle time, get swiss into ARAM before a game is picked
+    trace_begin(TRACE_SWISS_PRELOAD);
+    OSLockMutex(gm_card_mutex);
+    swiss_preload_aram();
+    OSUnlockMutex(gm_card_mutex);
+    trace_end(TRACE_SWISS_PRELOAD, 0);
+    aram_report();
+    bnr_cache_report();
+
+    // only writes when the setting is on and banners were added, takes the mutex per banner
+    bnr_cache_save();
+
+    // then the rest of the card, unless we are being stopped
+    if (!gm_enum_cancelled()) {
+        gm_crawl_start();
+    }
 
     game_enum_running = false;
     // DCBlockStore((void*)OSRoundDown32B((u32)&game_enum_running));
@@ -1195,7 +2212,11 @@ void *gm_thread_worker(void* param) {
 }
 
 void gm_init_thread() {
-    OSInitMutex(game_enum_mutex);
+    OSInitMutex(gm_card_mutex);
+
+    if (gm_dir_cache_base == ARAM_NONE) {
+        gm_dir_cache_base = aram_alloc(ARAM_OWNER_DIRS, GM_DIR_CACHE_ARAM_SIZE);
+    }
 }
 
 // match https://github.com/projectPiki/pikmin2/blob/snakecrowstate-work/include/Dolphin/OS/OSThread.h#L55-L74
@@ -1234,33 +2255,21 @@ void gm_start_thread(const char *target) {
         strcat(path, "/");
     }
 
+    // the crawler shares the card with the enum thread
+    gm_crawl_stop();
+    gm_asset_stop();
+
     OSReport("Starting game thread %s\n", path);
     strcpy(game_enum_path, path);
 
     game_enum_running = true;
     DCBlockStore((void*)OSRoundDown32B((u32)&game_enum_running));
-    
-    // OSUnlockMutex(game_enum_mutex);
-
-    if (gm_entry_count > 0) {
-        for (int i = 0; i < gm_entry_count; i++) {
-            gm_file_entry_t *entry = gm_entry_backing[i];
-            if (entry->type == GM_FILE_TYPE_GAME) {
-                gm_icon_free(&entry->asset.icon);
-                gm_banner_free(&entry->asset.banner);
-            } else {
-                gm_icon_free(&entry->asset.icon);
-            }
-            gm_free(entry);
-        }
-        gm_entry_count = 0;
-    }
-
-    number_of_lines = 0;
-    DCBlockStore((void*)OSRoundDown32B((u32)&number_of_lines));
 
-    game_backing_count = 0;
-    DCBlockStore((void*)OSRoundDown32B((u32)&game_backing_count));
+    // keep the directory we are leaving, then show the next one from the
+    // cache when it was visited before
+    gm_dir_cache_save();
+    gm_reset_entries();
+    gm_dir_restored = gm_dir_cache_restore(path);
 
     // Start the thread
     u32 thread_stack_size = sizeof(thread_stack);
@@ -1275,11 +2284,14 @@ void gm_start_thread(const char *target) {
 void gm_deinit_thread() {
     if (game_enum_running) {
         OSReport("Stopping file enum\n");
-        OSLockMutex(game_enum_mutex);
+        gm_cancel_requested = true;
         OSReport("Waiting for thread to exit, %d\n", game_enum_running);
-        OSJoinThread(&thread_obj, NULL);
+        gm_join_thread(&thread_obj, "enum");
         OSReport("File enum done\n");
-        OSUnlockMutex(game_enum_mutex);
+        gm_cancel_requested = false;
     }
+
+    gm_crawl_stop();
+    gm_asset_stop();
 }
 
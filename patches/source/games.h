@@ -7,6 +7,7 @@
 #include "bnr.h"
 
 #include "decomp_ar.h"
+#include "sort_key.h"
 
 // Backing
 typedef enum {
@@ -25,22 +26,20 @@ typedef enum {
     GM_FILE_TYPE_GAME
 } gm_file_type_t;
 
-#pragma pack(push,1)
+// bare texture data, the pools are packed slabs the GPU reads in place
 typedef struct {
-    u32 used;
-    u32 padding[7];
     u8 data[ICON_PIXELDATA_LEN];
-} gm_icon_buf_t;
+} gm_icon_buf_t __attribute__((aligned(32)));
 
+// the description follows the pixels like it does in the BNR, so one
+// transfer out of the banner cache brings both
 typedef struct {
-    u32 used;
-    u32 padding[7];
     u8 data[BNR_PIXELDATA_LEN];
+    BNRDesc desc;
 } gm_banner_buf_t __attribute__((aligned(32)));
-#pragma pack(pop)
 
+// transfers go through line batches (arq_batch_t), no request per entry
 typedef struct {
-    ARQRequest req;
     u32 aram_offset;
     bool schedule_free;
     gm_load_state_t state;
@@ -48,8 +47,6 @@ typedef struct {
 } gm_icon_t;
 
 typedef struct {
-    ARQRequest req;
-    u32 aram_offset;
     bool schedule_free;
     gm_load_state_t state;
     gm_banner_buf_t *buf;
@@ -79,18 +76,25 @@ typedef struct {
     u32 dvd_fst_offset;
     u32 dvd_fst_size;
     u32 dvd_max_fst_size;
+    u32 file_size; // from the directory entry, used to revalidate the catalog
+    u32 file_mtime; // FAT date << 16 | time
 } gm_extra_t;
 
 typedef struct {
     char path[128];
     gm_file_type_t type;
+    gm_extra_t extra; // filled while listing when the header is a known dump
 } gm_path_entry_t;
 
 typedef struct gm_file_entry_struct gm_file_entry_t;
 
+// fixed size record in the entry store, the path is split into the
+// directory (stored once) and a leaf name in the string arena. Only what
+// the grid and the loaders touch for every entry lives here, the banner
+// description comes in with the banner, see gm_entry_desc
 struct gm_file_entry_struct {
-    char path[128];
-    BNRDesc desc;
+    u32 name; // arena offset, see gm_entry_path
+    u32 sort_key; // arena offset of the title key, 0 sorts by the file name
     gm_extra_t extra;
     gm_asset_t asset;
     gm_file_type_t type;
@@ -98,20 +102,37 @@ struct gm_file_entry_struct {
     bool meta_ready;
 };
 
+// copied out of the entry store on selection, lowmem is gone by bs2start
+typedef struct gm_boot_entry_struct gm_boot_entry_t;
+
+struct gm_boot_entry_struct {
+    char path[128];
+    gm_file_type_t type;
+    gm_extra_t extra;
+    gm_boot_entry_t *second;
+};
+
+#define GM_MAX_ENTRIES 12288
+#define GM_MAX_LINES (GM_MAX_ENTRIES / 8)
+
 extern int number_of_lines;
 extern int game_backing_count;
-extern OSMutex *game_enum_mutex;
 extern bool game_enum_running;
 extern char game_enum_path[];
 
 // for boot but defined in main (???)
-extern gm_file_entry_t boot_entry;
-extern gm_file_entry_t second_boot_entry;
+extern gm_boot_entry_t boot_entry;
+extern gm_boot_entry_t second_boot_entry;
 
-void gm_init_heap();
 void gm_init_thread();
 void gm_deinit_thread();
 void gm_start_thread(const char *target);
+bool gm_enum_cancelled();
+void gm_card_lock();
+void gm_card_unlock();
 void gm_line_changed(int delta);
 bool gm_can_move();
 gm_file_entry_t *gm_get_game_entry(int index);
+char *gm_entry_path(gm_file_entry_t *entry, char *buf);
+void gm_entry_desc(gm_file_entry_t *entry, BNRDesc *desc);
+void gm_get_boot_entry(gm_file_entry_t *entry, gm_boot_entry_t *boot, gm_boot_entry_t *second);
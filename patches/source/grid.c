@@ -15,7 +15,7 @@
 #define START_LINE 0
 #define ANIM_DIRECTION_UP 0
 #define ANIM_DIRECTION_DOWN 1
-#define MAX_LINES 240 // 240 lines * 8 slots = 1920 slots
+#define MAX_LINES GM_MAX_LINES // 8 slots per line
 
 bool grid_setup_done = false;
 __attribute_data_empty__ line_backing_t browser_lines[MAX_LINES];
@@ -37,6 +37,11 @@ f32 get_position_after(line_backing_t *line_backing) {
 
 // other stuff
 void grid_setup_func() {
+    grid_setup_at(START_LINE, START_LINE * 8);
+}
+
+// same as above but scrolled, used when a directory is restored
+void grid_setup_at(int top_line, int slot) {
     OSReport("browser_lines = %p\n", browser_lines);
     OSReport("number_of_lines = %d\n", number_of_lines);
 
@@ -50,8 +55,8 @@ void grid_setup_func() {
     }
 
     // initial
-    selected_slot = START_LINE * 8;
-    top_line_num = START_LINE;
+    selected_slot = slot;
+    top_line_num = top_line;
 
     for (int line_num = 0; line_num < number_of_lines; line_num++) {
         line_backing_t *line_backing = &browser_lines[line_num];
@@ -59,9 +64,9 @@ void grid_setup_func() {
  
         int row = line_num;
         f32 raw_pos_y = (row * offset_y);
-        line_backing->raw_position_y = DRAW_BOUND_TOP - (offset_y * START_LINE) + raw_pos_y;
+        line_backing->raw_position_y = DRAW_BOUND_TOP - (offset_y * top_line) + raw_pos_y;
         line_backing->transparency = 1.0;
-        if (line_num < START_LINE || line_num >= START_LINE + DRAW_TOTAL_ROWS) {
+        if (line_num < top_line || line_num >= top_line + DRAW_TOTAL_ROWS) {
             line_backing->transparency = 0.0;
         }
 
@@ -76,6 +81,33 @@ void grid_setup_func() {
     return;
 }
 
+// add lines below the last one while entries are still being listed
+void grid_extend_lines(int line_count) {
+    if (!grid_setup_done) return;
+    if (line_count > MAX_LINES) line_count = MAX_LINES;
+
+    for (int line_num = number_of_lines; line_num < line_count; line_num++) {
+        line_backing_t *prev_backing = &browser_lines[line_num - 1];
+        line_backing_t *line_backing = &browser_lines[line_num];
+
+        // follow the previous line, including any scroll that is in flight
+        line_backing->raw_position_y = prev_backing->raw_position_y + offset_y;
+        line_backing->anims = prev_backing->anims;
+        line_backing->moving_in = false;
+        line_backing->moving_out = false;
+
+        f32 position_y = get_position_after(line_backing);
+        line_backing->transparency = 0.0;
+        if (position_y >= DRAW_BOUND_TOP && position_y < DRAW_BOUND_BOTTOM) {
+            line_backing->transparency = 1.0;
+        }
+    }
+
+    if (line_count > number_of_lines) {
+        number_of_lines = line_count;
+    }
+}
+
 void grid_add_anim(int line_num, int direction, f32 distance) {
     line_backing_t *line_backing = &browser_lines[line_num];
     anim_list_t *anims = &line_backing->anims;
@@ -42,6 +42,8 @@ extern line_backing_t browser_lines[];
 f32 get_position_after(line_backing_t *line_backing);
 
 void grid_setup_func();
+void grid_setup_at(int top_line, int slot);
+void grid_extend_lines(int line_count);
 int grid_dispatch_navigate_up();
 int grid_dispatch_navigate_down();
 void grid_update_icon_positions();
@@ -23,6 +23,7 @@
 #include "dol.h"
 #include "boot.h"
 #include "gameid.h"
+#include "trace.h"
 
 #define CUBE_TEX_WIDTH 84
 #define CUBE_TEX_HEIGHT 84
@@ -80,8 +81,8 @@ __attribute_data__ static GXColorS10 color_bg_outer_0;
 __attribute_data__ static GXColorS10 color_bg_outer_1;
 
 // start
-__attribute_data__ gm_file_entry_t boot_entry;
-__attribute_data__ gm_file_entry_t second_boot_entry;
+__attribute_data__ gm_boot_entry_t boot_entry;
+__attribute_data__ gm_boot_entry_t second_boot_entry;
 
 __attribute_used__ void mod_cube_colors() {
     if (cube_color == 0) {
@@ -348,10 +349,10 @@ __attribute_used__ void mod_cube_anim() {
 }
 
 __attribute_used__ void pre_thread_init() {
+    trace_mark(TRACE_IPL_START, 0);
     dolphin_ARAMInit();
     orig_thread_init();
 
-    gm_init_heap();
     gm_init_thread();
     if (!start_passthrough_game) {
         gm_start_thread("/");
@@ -359,6 +360,7 @@ __attribute_used__ void pre_thread_init() {
 }
 
 __attribute_used__ void pre_menu_init(int unk) {
+    trace_begin(TRACE_MENU_INIT);
     menu_init(unk);
 
     // change default menu
@@ -370,6 +372,7 @@ __attribute_used__ void pre_menu_init(int unk) {
     mod_cube_colors();
     mod_cube_text();
     mod_cube_anim();
+    trace_end(TRACE_MENU_INIT, 0);
 
     // delay before boot animation (to wait for GCVideo)
     const int fps = rmode->viTVMode >> 2 == VI_NTSC ? 60 : 50;
@@ -465,6 +468,7 @@ __attribute_used__ u32 bs2tick() {
 
 __attribute_used__ void bs2start() {
     OSReport("DONE\n");
+    trace_begin(TRACE_GAME_BOOT);
 
     // read boot info into lowmem
     struct dolphin_lowmem *lowmem = (struct dolphin_lowmem*)0x80000000;
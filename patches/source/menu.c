@@ -24,6 +24,7 @@
 #include "os.h"
 
 #include "time.h"
+#include "trace.h"
 
 // TODO: this is all zeros except for one BNRDesc, so replace it with a sparse version
 #include "default_opening_bin.h"
@@ -526,6 +527,12 @@ __attribute_used__ void custom_gameselect_menu(u8 broken_alpha_0, u8 alpha_1, u8
     // u8 ui_alpha = alpha_2; // correct with animation
     GXColor white = {0xFF, 0xFF, 0xFF, ui_alpha};
 
+    static bool first_frame = true;
+    if (first_frame) {
+        first_frame = false;
+        trace_mark(TRACE_MENU_READY, game_backing_count);
+    }
+
     // text
     draw_text("cubiboot loader", 20, 20, 4, &white);
     draw_text("Load Disc (Z)", 20, 320, 4, &white);
@@ -596,8 +603,10 @@ __attribute_used__ void custom_gameselect_menu(u8 broken_alpha_0, u8 alpha_1, u8
         else switch_lang_eng();
 
         // info
-        draw_blob_text(make_type('t','i','t','l'), menu_blob, &white, entry->desc.fullGameName, 0x1f);
-        draw_blob_text(make_type('i','n','f','o'), menu_blob, &white, entry->desc.description, 0x1f);
+        BNRDesc desc;
+        gm_entry_desc(entry, &desc);
+        draw_blob_text(make_type('t','i','t','l'), menu_blob, &white, desc.fullGameName, 0x1f);
+        draw_blob_text(make_type('i','n','f','o'), menu_blob, &white, desc.description, 0x1f);
 
         switch_lang_eng();
         if (entry->type == GM_FILE_TYPE_PROGRAM || entry->type == GM_FILE_TYPE_DIRECTORY) {
@@ -662,13 +671,15 @@ __attribute_used__ void original_gameselect_menu(u8 broken_alpha_0, u8 alpha_1,
     }
 
     // game info
+    BNRDesc desc;
+    gm_entry_desc(entry, &desc);
     prep_text_mode();
-    draw_blob_text(make_type('t','i','t','l'), game_blob_b, &white, entry->desc.fullGameName, 0x40);
+    draw_blob_text(make_type('t','i','t','l'), game_blob_b, &white, desc.fullGameName, 0x40);
     if (entry->type == GM_FILE_TYPE_GAME) {
-        draw_blob_text(make_type('m','a','k','r'), game_blob_b, &white, entry->desc.fullCompany, 0x40);
-        draw_blob_text_long(make_type('i','n','f','o'), game_blob_b, &white, entry->desc.description, 0x80);
+        draw_blob_text(make_type('m','a','k','r'), game_blob_b, &white, desc.fullCompany, 0x40);
+        draw_blob_text_long(make_type('i','n','f','o'), game_blob_b, &white, desc.description, 0x80);
     } else {
-        draw_blob_text(make_type('m','a','k','r'), game_blob_b, &white, entry->desc.description, 0x40);
+        draw_blob_text(make_type('m','a','k','r'), game_blob_b, &white, desc.description, 0x40);
     }
 
     // press start anim
@@ -805,7 +816,7 @@ __attribute_used__ s32 handle_gameselect_inputs() {
                 Jac_PlaySe(SOUND_SUBMENU_ENTER);
 
                 char path[128];
-                sprintf(path, "%s/", entry->path);
+                strcat(gm_entry_path(entry, path), "/");
                 gm_start_thread(path);
             } else {
                 in_submenu_transition = true;
@@ -836,11 +847,7 @@ __attribute_used__ s32 handle_gameselect_inputs() {
         if (!emu_can_boot(entry->type))
             return MENU_GAMESELECT_TRANSITION_ID;
 
-        memcpy(&boot_entry, entry, sizeof(gm_file_entry_t));
-        if (boot_entry.second != NULL) {
-            memcpy(&second_boot_entry, boot_entry.second, sizeof(gm_file_entry_t));
-            boot_entry.second = &second_boot_entry;
-        }
+        gm_get_boot_entry(entry, &boot_entry, &second_boot_entry);
         *bs2start_ready = 1;
     }
 
@@ -0,0 +1,105 @@
+#include <gctypes.h>
+
+#include "picolibc.h"
+
+#include "sort_key.h"
+
+#define SJIS_LEAD(c) (((c) >= 0x81 && (c) <= 0x9F) || ((c) >= 0xE0 && (c) <= 0xFC))
+
+static const char *sort_key_articles[] = { "the ", "a ", "an " };
+
+static inline u8 sort_key_lower(u8 c) {
+    return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+static inline bool sort_key_alnum(u8 c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z');
+}
+
+// full width latin, digits and space fold to ASCII, 0 when not applicable
+static u8 sort_key_sjis_ascii(u16 c) {
+    if (c == 0x8140) return ' ';
+    if (c >= 0x824F && c <= 0x8258) return '0' + (c - 0x824F);
+    if (c >= 0x8260 && c <= 0x8279) return 'a' + (c - 0x8260);
+    if (c >= 0x8281 && c <= 0x829A) return 'a' + (c - 0x8281);
+    return 0;
+}
+
+// katakana ァ..ン onto hiragana ぁ..ん (0x837F is not a valid trail byte)
+static u16 sort_key_sjis_kana(u16 c) {
+    if (c >= 0x8340 && c <= 0x837E) return 0x829F + (c - 0x8340);
+    if (c >= 0x8380 && c <= 0x8393) return 0x829F + (c - 0x8341);
+    return c;
+}
+
+void sort_key_make(char *key, const char *src, bool strip_ext) {
+    const u8 *in = (const u8*)src;
+    const u8 *end = in + strlen(src);
+    if (strip_ext) {
+        const u8 *ext = (const u8*)strrchr(src, '.');
+        if (ext != NULL && ext != in) end = ext;
+    }
+
+    // first pass folds into a scratch buffer, the article check needs the folded text
+    char folded[128];
+    int len = 0;
+    bool space = true; // drops leading and repeated spaces
+    while (in < end && len < sizeof(folded) - 2) {
+        u8 c = *in++;
+
+        if (SJIS_LEAD(c) && in < end) {
+            u16 wide = (c << 8) | *in++;
+            u8 ascii = sort_key_sjis_ascii(wide);
+            if (ascii == 0) {
+                wide = sort_key_sjis_kana(wide);
+                folded[len++] = wide >> 8;
+                folded[len++] = wide & 0xFF;
+                space = false;
+                continue;
+            }
+            c = ascii;
+        }
+
+        c = sort_key_lower(c);
+        if (c == '\'') continue; // "bug's" sorts as "bugs"
+        if (sort_key_alnum(c) || c >= 0x80) {
+            folded[len++] = c;
+            space = false;
+        } else if (!space) {
+            // any run of punctuation and spaces becomes one separator
+            folded[len++] = ' ';
+            space = true;
+        }
+    }
+    while (len > 0 && folded[len - 1] == ' ') len--;
+    folded[len] = 0;
+
+    const char *text = folded;
+    for (int i = 0; i < sizeof(sort_key_articles) / sizeof(sort_key_articles[0]); i++) {
+        int article_len = strlen(sort_key_articles[i]);
+        if (len > article_len && strncmp(text, sort_key_articles[i], article_len) == 0) {
+            text += article_len;
+            break;
+        }
+    }
+
+    // second pass encodes digit runs as <length><digits> without leading zeros
+    int out = 0;
+    while (*text && out < SORT_KEY_LEN - 1) {
+        if (*text < '0' || *text > '9') {
+            key[out++] = *text++;
+            continue;
+        }
+
+        while (text[0] == '0' && text[1] >= '0' && text[1] <= '9') text++;
+        int digits = 0;
+        while (text[digits] >= '0' && text[digits] <= '9') digits++;
+
+        key[out++] = '0' + (digits < 9 ? digits : 9);
+        for (int i = 0; i < digits && out < SORT_KEY_LEN - 1; i++) {
+            key[out++] = text[i];
+        }
+        text += digits;
+    }
+    key[out] = 0;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gctypes.h>
+
+// Normalized sort keys, compared with a plain strcmp.
+// - ASCII and full width latin are casefolded, punctuation is dropped
+// - a leading "the", "a" or "an" is skipped
+// - digit runs are prefixed with their length so numbers sort numerically
+// - Shift-JIS is kept as is, except katakana folds onto hiragana so kana
+//   titles sort together in gojuon order
+
+#define SORT_KEY_LEN 32
+
+void sort_key_make(char *key, const char *src, bool strip_ext);
@@ -0,0 +1,146 @@
+#include <gctypes.h>
+#include <stdarg.h>
+
+#include "picolibc.h"
+#include "attr.h"
+#include "reloc.h"
+#include "time.h"
+#include "usbgecko.h"
+#include "flippy_sync.h"
+
+#include "trace.h"
+
+// OS_CURRENT_THREAD in lowmem
+#define TRACE_CURRENT_THREAD (*(volatile u32*)0x800000E4)
+#define TRACE_MAX_THREADS 7
+
+// filled by cubeboot, see trace_handoff
+__attribute_aligned_data__ trace_ring_t trace_ring = {
+    .magic = TRACE_MAGIC,
+};
+
+__attribute_data__ u32 trace_dump_target = TRACE_DUMP_NONE;
+__attribute_data__ static u32 trace_threads[TRACE_MAX_THREADS];
+
+static const char *trace_names[] = TRACE_EVENT_NAMES;
+
+static u8 trace_thread_id() {
+    u32 current = TRACE_CURRENT_THREAD;
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        if (trace_threads[i] == 0) trace_threads[i] = current;
+        if (trace_threads[i] == current) return i + 1;
+    }
+
+    return TRACE_MAX_THREADS + 1;
+}
+
+void trace_event(u16 event, u8 phase, u32 arg) {
+    BOOL enabled = OSDisableInterrupts();
+
+    trace_record_t *rec = &trace_ring.records[trace_ring.head++ & (TRACE_RING_SIZE - 1)];
+    rec->time = gettime();
+    rec->event = event;
+    rec->phase = phase;
+    rec->thread = trace_thread_id();
+    rec->arg = arg;
+
+    OSRestoreInterrupts(enabled);
+}
+
+// the dump runs right before the jump into the game, so stay out of lowmem
+__attribute__((aligned(32))) static char trace_buf[0x800];
+
+typedef struct {
+    u32 target;
+    u32 len;
+    u32 offset;
+    bool failed;
+} trace_out_t;
+
+static void trace_flush(trace_out_t *out) {
+    if (out->len == 0)
+        return;
+
+    if (out->target == TRACE_DUMP_SD) {
+        if (!out->failed && dvd_custom_write(trace_buf, out->offset, out->len, 0) != 0) {
+            custom_OSReport("Trace write failed at %u\n", out->offset);
+            out->failed = true;
+        }
+    } else {
+        custom_OSReport("%s", trace_buf); // lines fit in a single report
+    }
+
+    out->offset += out->len;
+    out->len = 0;
+}
+
+static void trace_emit(trace_out_t *out, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(&trace_buf[out->len], sizeof(trace_buf) - out->len, fmt, args);
+    va_end(args);
+
+    if (len > 0) out->len += len;
+    if (out->target != TRACE_DUMP_SD || out->len > sizeof(trace_buf) - 256) {
+        trace_flush(out);
+    }
+}
+
+// Writes the ring as a Chrome trace (chrome://tracing, ui.perfetto.dev)
+void trace_dump(u32 target) {
+    if (target == TRACE_DUMP_NONE || trace_ring.magic != TRACE_MAGIC)
+        return;
+
+    u32 head = trace_ring.head;
+    u32 first = head > TRACE_RING_SIZE ? head - TRACE_RING_SIZE : 0;
+    if (head == first)
+        return;
+
+    u64 start_time = gettime();
+    trace_out_t out = { .target = target };
+
+    if (target == TRACE_DUMP_SD) {
+        dvd_custom_unlink(TRACE_DUMP_PATH);
+        if (dvd_custom_open(TRACE_DUMP_PATH, FILE_ENTRY_TYPE_FILE, IPC_FILE_FLAG_DISABLESPEEDEMU | IPC_FILE_FLAG_WRITE) != 0) {
+            custom_OSReport("Trace dump: failed to open %s\n", TRACE_DUMP_PATH);
+            return;
+        }
+    } else {
+        custom_OSReport("TRACE BEGIN\n");
+    }
+
+    // timestamps are microseconds since the oldest record still in the ring
+    u64 base_time = trace_ring.records[first & (TRACE_RING_SIZE - 1)].time;
+
+    trace_emit(&out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (u32 i = first; i < head; i++) {
+        trace_record_t *rec = &trace_ring.records[i & (TRACE_RING_SIZE - 1)];
+        const char *name = rec->event < TRACE_EVENT_COUNT ? trace_names[rec->event] : "unknown";
+        u32 ts = (u32)ticks_to_microsecs(diff_ticks(base_time, rec->time));
+
+        if (rec->phase == TRACE_PHASE_COUNTER) {
+            trace_emit(&out, "{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%u,\"pid\":1,\"tid\":%u,\"args\":{\"value\":%u}},\n",
+                name, ts, rec->thread, rec->arg);
+        } else {
+            trace_emit(&out, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%u,\"pid\":1,\"tid\":%u,\"args\":{\"arg\":%u}},\n",
+                name, rec->phase, ts, rec->thread, rec->arg);
+        }
+    }
+
+    for (int i = 0; i < TRACE_MAX_THREADS && trace_threads[i] != 0; i++) {
+        trace_emit(&out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"ipl %08x\"}},\n",
+            i + 1, trace_threads[i]);
+    }
+    trace_emit(&out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"cubeboot\"}}\n]}\n");
+    trace_flush(&out);
+
+    if (target == TRACE_DUMP_SD) {
+        dvd_custom_close(0);
+    } else {
+        custom_OSReport("TRACE END\n");
+    }
+
+    f32 runtime = (f32)diff_usec(start_time, gettime()) / 1000.0;
+    custom_OSReport("Trace dump took=%f (%u records, %u bytes)\n", runtime, head - first, out.offset);
+    (void)runtime;
+}